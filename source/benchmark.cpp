@@ -19,6 +19,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <sstream>
 #include <vector>
 
 #include "position.h"
@@ -123,7 +124,7 @@ void benchmark(int argc, char* argv[]) {
 
       if (valType == "perft")
       {
-          int64_t cnt = perft(pos, limits.maxDepth * ONE_PLY);
+          int64_t cnt = perft(pos, limits.maxDepth * ONE_PLY, Options["Threads"].value<int>(), false);
           totalNodes += cnt;
 
           cerr << "\nPerft " << limits.maxDepth << " nodes counted: " << cnt << endl;
@@ -151,3 +152,65 @@ void benchmark(int argc, char* argv[]) {
   cin >> time;
   #endif
 }
+
+
+/// perft_suite() checks the move generator against a file of positions with
+/// known perft counts, one per line in the usual perftsuite format, that is
+/// a FEN string followed by ";D1 <count> ;D2 <count> ...". The depths above
+/// maxDepth are skipped. Returns true if all the counts match.
+
+bool perft_suite(const string& fileName, int maxDepth) {
+
+  ifstream f(fileName.c_str());
+  string line, token;
+  int64_t totalNodes = 0, expected;
+  int positions = 0, failures = 0;
+  int time = get_system_time();
+
+  if (!f.is_open())
+  {
+      cerr << "Unable to open perft suite " << fileName << endl;
+      return false;
+  }
+
+  while (getline(f, line))
+  {
+      if (line.empty())
+          continue;
+
+      size_t sep = line.find(';');
+      string fen = line.substr(0, line.find_last_not_of(' ', sep - 1) + 1);
+      istringstream counts(sep == string::npos ? "" : line.substr(sep));
+      Position pos(fen, false, 0);
+
+      positions++;
+
+      while (counts >> token >> expected)
+      {
+          int depth = atoi(token.c_str() + 2); // Skip the ";D" prefix
+
+          if (depth > maxDepth)
+              continue;
+
+          int64_t cnt = perft(pos, depth * ONE_PLY, Options["Threads"].value<int>(), false);
+          totalNodes += cnt;
+
+          if (cnt != expected)
+          {
+              failures++;
+              cout << "Perft " << depth << " of " << fen << ": counted " << cnt
+                   << ", expected " << expected << endl;
+          }
+      }
+  }
+
+  time = get_system_time() - time;
+
+  cout << "\nPositions       : " << positions
+       << "\nFailures        : " << failures
+       << "\nTotal time (ms) : " << time
+       << "\nNodes counted   : " << totalNodes
+       << "\nNodes/second    : " << (int)(totalNodes / (Max(time, 1) / 1000.0)) << endl;
+
+  return failures == 0;
+}
@@ -18,8 +18,10 @@
 */
 
 #include <cassert>
+#include <cstdio>
 
 #include "bitboard.h"
+#include "kpkbitbase.h"
 #include "types.h"
 
 namespace {
@@ -48,9 +50,6 @@ namespace {
   // The possible pawns squares are 24, the first 4 files and ranks from 2 to 7
   const int IndexMax = 2 * 24 * 64 * 64; // color * wp_sq * wk_sq * bk_sq
 
-  // Each uint32_t stores results of 32 positions, one per bit
-  uint32_t KPKBitbase[IndexMax / 32];
-
   Result classify_wtm(const KPKPosition& pos, const Result bb[]);
   Result classify_btm(const KPKPosition& pos, const Result bb[]);
   int compute_index(Square wksq, Square bksq, Square wpsq, Color stm);
@@ -65,9 +64,15 @@ uint32_t probe_kpk_bitbase(Square wksq, Square wpsq, Square bksq, Color stm) {
 }
 
 
-void init_kpk_bitbase() {
+/// print_kpk_bitbase() computes the KPK bitbase by retrograde analysis and
+/// prints it in the format of kpkbitbase.h, the table the engine is compiled
+/// with, so that the analysis is not run again at every startup. The header
+/// is regenerated with "stockfish kpkgen > kpkbitbase.h".
+
+void print_kpk_bitbase() {
 
   Result bb[IndexMax];
+  uint32_t bitbase[IndexMax / 32] = { 0 };
   KPKPosition pos;
   bool repeat;
 
@@ -101,7 +106,49 @@ void init_kpk_bitbase() {
   for (int i = 0; i < IndexMax / 32; i++)
       for (int j = 0; j < 32; j++)
           if (bb[32 * i + j] == RESULT_WIN || bb[32 * i + j] == RESULT_LOSS)
-              KPKBitbase[i] |= (1 << j);
+              bitbase[i] |= (1 << j);
+
+  printf("/*\n"
+         "  Stockfish, a UCI chess playing engine derived from Glaurung 2.1\n"
+         "  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)\n"
+         "  Copyright (C) 2008-2010 Marco Costalba, Joona Kiiski, Tord Romstad\n"
+         "\n"
+         "  Stockfish is free software: you can redistribute it and/or modify\n"
+         "  it under the terms of the GNU General Public License as published by\n"
+         "  the Free Software Foundation, either version 3 of the License, or\n"
+         "  (at your option) any later version.\n"
+         "\n"
+         "  Stockfish is distributed in the hope that it will be useful,\n"
+         "  but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+         "  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+         "  GNU General Public License for more details.\n"
+         "\n"
+         "  You should have received a copy of the GNU General Public License\n"
+         "  along with this program.  If not, see <http://www.gnu.org/licenses/>.\n"
+         "*/\n"
+         "\n"
+         "// Generated by \"stockfish kpkgen\", do not edit. See print_kpk_bitbase()\n"
+         "// in bitbase.cpp for the retrograde analysis and the index layout.\n"
+         "\n"
+         "#if !defined(KPKBITBASE_H_INCLUDED)\n"
+         "#define KPKBITBASE_H_INCLUDED\n"
+         "\n"
+         "#include \"types.h\"\n"
+         "\n"
+         "namespace {\n"
+         "\n"
+         "// Each uint32_t stores results of 32 positions, one per bit\n"
+         "const uint32_t KPKBitbase[%d] = {\n", IndexMax / 32);
+
+  for (int i = 0; i < IndexMax / 32; i++)
+      printf("%s0x%08X%s", i % 8 ? " " : "  ", bitbase[i],
+             i == IndexMax / 32 - 1 ? "\n" : i % 8 == 7 ? ",\n" : ",");
+
+  printf("};\n"
+         "\n"
+         "}\n"
+         "\n"
+         "#endif // !defined(KPKBITBASE_H_INCLUDED)\n");
 }
 
 
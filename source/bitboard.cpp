@@ -156,6 +156,16 @@ const int RShift[64] = {
 
 #endif // defined(IS_64BIT)
 
+// The pext indices are 64-bit subsets of the mask, the 32-bit magics can't use them
+#if defined(USE_PEXT) && !defined(IS_64BIT)
+#error "USE_PEXT requires IS_64BIT"
+#endif
+
+// Detected once at startup, before init_bitboards() fills the slider tables
+#if defined(USE_PEXT)
+extern const bool CpuHasPEXT = cpu_has_pext();
+#endif
+
 // Global bitboards definitions with static storage duration are
 // automatically set to zero before enter main().
 Bitboard RMask[64];
@@ -448,7 +458,12 @@ namespace {
         {
             b = index_to_bitboard(k, mask[i]);
             v = CpuIs64Bit ? b * mult[i] : unsigned(b * mult[i] ^ (b >> 32) * (mult[i] >> 32));
-            attacks[index + (v >> shift[i])] = sliding_attacks(i, b, deltas, 0, 7, 0, 7);
+
+            // With pext the k-th subset of the mask is stored at index k
+            if (CpuHasPEXT)
+                attacks[index + k] = sliding_attacks(i, b, deltas, 0, 7, 0, 7);
+            else
+                attacks[index + (v >> shift[i])] = sliding_attacks(i, b, deltas, 0, 7, 0, 7);
         }
         index += j;
     }
@@ -166,19 +166,53 @@ inline Bitboard in_front_bb(Color c, Square s) {
 }
 
 
+/// pext() extracts the bits of b selected by mask and packs them in the low
+/// bits of the result. To be called only when CpuHasPEXT is true.
+
+#if defined(USE_PEXT)
+
+#if defined(_MSC_VER)
+
+inline Bitboard pext(Bitboard b, Bitboard mask) {
+  return _pext_u64(b, mask);
+}
+#else
+
+inline Bitboard pext(Bitboard b, Bitboard mask) {
+  Bitboard result;
+  __asm__("pextq %2, %1, %0" : "=r" (result) : "r" (b), "r" (mask));
+  return result;
+}
+#endif
+
+#endif
+
+
 /// Functions for computing sliding attack bitboards. rook_attacks_bb(),
 /// bishop_attacks_bb() and queen_attacks_bb() all take a square and a
 /// bitboard of occupied squares as input, and return a bitboard representing
 /// all squares attacked by a rook, bishop or queen on the given square.
 
+/// When the CPU has a fast pext instruction the tables are indexed by the
+/// blockers extracted with pext instead of the magic multiplication, the
+/// choice is made once at startup by init_bitboards().
+
 #if defined(IS_64BIT)
 
 inline Bitboard rook_attacks_bb(Square s, Bitboard blockers) {
+#if defined(USE_PEXT)
+  if (CpuHasPEXT)
+      return RAttacks[RAttackIndex[s] + pext(blockers, RMask[s])];
+#endif
   Bitboard b = blockers & RMask[s];
   return RAttacks[RAttackIndex[s] + ((b * RMult[s]) >> RShift[s])];
 }
 
 inline Bitboard bishop_attacks_bb(Square s, Bitboard blockers) {
+#if defined(USE_PEXT)
+  if (CpuHasPEXT)
+      return BAttacks[BAttackIndex[s] + pext(blockers, BMask[s])];
+#endif
   Bitboard b = blockers & BMask[s];
   return BAttacks[BAttackIndex[s] + ((b * BMult[s]) >> BShift[s])];
 }
@@ -18,6 +18,7 @@
 */
 
 #include <cassert>
+#include <cstring>
 
 #include "bitcount.h"
 #include "endgame.h"
@@ -101,11 +102,16 @@ namespace {
 
 /// Endgames member definitions
 
-template<> const Endgames::EFMap& Endgames::get<EF>() const { return maps.first; }
-template<> const Endgames::SFMap& Endgames::get<SF>() const { return maps.second; }
+template<> EF*& Endgames::func<EF>(Entry& e) { return e.ef; }
+template<> SF*& Endgames::func<SF>(Entry& e) { return e.sf; }
+template<> EF* Endgames::func<EF>(const Entry& e) { return e.ef; }
+template<> SF* Endgames::func<SF>(const Entry& e) { return e.sf; }
 
 Endgames::Endgames() {
 
+  memset(table, 0, sizeof(table));
+  hitCount = missCount = 0;
+
   add<Endgame<Value, KNNK>  >("KNNK");
   add<Endgame<Value, KPK>   >("KPK");
   add<Endgame<Value, KBNK>  >("KBNK");
@@ -125,28 +131,54 @@ Endgames::Endgames() {
 
 Endgames::~Endgames() {
 
-  for (EFMap::const_iterator it = get<EF>().begin(); it != get<EF>().end(); ++it)
-      delete it->second;
-
-  for (SFMap::const_iterator it = get<SF>().begin(); it != get<SF>().end(); ++it)
-      delete it->second;
+  for (int i = 0; i < TableSize; i++)
+  {
+      delete table[i].ef;
+      delete table[i].sf;
+  }
 }
 
 template<class T>
 void Endgames::add(const string& keyCode) {
 
   typedef typename T::Base F;
-  typedef std::map<Key, F*> M;
 
-  const_cast<M&>(get<F>()).insert(std::pair<Key, F*>(mat_key(keyCode), new T(WHITE)));
-  const_cast<M&>(get<F>()).insert(std::pair<Key, F*>(mat_key(swap_colors(keyCode)), new T(BLACK)));
+  insert<F>(mat_key(keyCode), new T(WHITE));
+  insert<F>(mat_key(swap_colors(keyCode)), new T(BLACK));
+}
+
+template<class T>
+void Endgames::insert(Key key, T* f) {
+
+  int i = int(key & (TableSize - 1));
+
+  // Skip the slots taken by other keys, an empty slot has no function
+  while ((table[i].ef || table[i].sf) && table[i].key != key)
+      i = (i + 1) & (TableSize - 1);
+
+  assert(!func<T>(table[i]));
+
+  table[i].key = key;
+  func<T>(table[i]) = f;
 }
 
 template<class T>
 T* Endgames::get(Key key) const {
 
-  typename std::map<Key, T*>::const_iterator it = get<T>().find(key);
-  return it != get<T>().end() ? it->second : NULL;
+  int i = int(key & (TableSize - 1));
+
+  // The probe sequence of a key not stored ends at an empty slot
+  while ((table[i].ef || table[i].sf) && table[i].key != key)
+      i = (i + 1) & (TableSize - 1);
+
+  T* f = func<T>(table[i]);
+
+  if (f)
+      hitCount++;
+  else
+      missCount++;
+
+  return f;
 }
 
 // Explicit template instantiations
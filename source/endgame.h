@@ -21,7 +21,6 @@
 #define ENDGAME_H_INCLUDED
 
 #include <string>
-#include <map>
 
 #include "position.h"
 #include "types.h"
@@ -85,28 +84,42 @@ private:
 };
 
 
-/// Endgames class stores in two std::map the pointers to endgame evaluation
-/// and scaling base objects. Then we use polymorphism to invoke the actual
-/// endgame function calling its apply() method that is virtual.
+/// Endgames class stores the pointers to endgame evaluation and scaling base
+/// objects in a small open addressing hash table indexed by material key and
+/// probed linearly, which fits in a few cache lines. Then we use polymorphism
+/// to invoke the actual endgame function calling its apply() method that is
+/// virtual. The lookups are counted, found or not, for the search statistics.
 
 class Endgames {
 
-  typedef std::map<Key, EndgameBase<Value>* > EFMap;
-  typedef std::map<Key, EndgameBase<ScaleFactor>* > SFMap;
+  // Twice the number of stored functions, so that the probe sequences of
+  // the keys not found stop at an empty slot after a couple of steps.
+  static const int TableSize = 64;
+
+  struct Entry {
+    Key key;
+    EndgameBase<Value>* ef;
+    EndgameBase<ScaleFactor>* sf;
+  };
 
 public:
   Endgames();
   ~Endgames();
   template<class T> T* get(Key key) const;
+  uint64_t hits() const { return hitCount; }
+  uint64_t misses() const { return missCount; }
+  void clear_stats() { hitCount = missCount = 0; }
 
 private:
   template<class T> void add(const std::string& keyCode);
+  template<class T> void insert(Key key, T* f);
 
-  // Here we store two maps, for evaluate and scaling functions...
-  std::pair<EFMap, SFMap> maps;
+  Entry table[TableSize];
+  mutable uint64_t hitCount, missCount;
 
-  // ...and here is the accessing template function
-  template<typename T> const std::map<Key, T*>& get() const;
+  // Accessing template function to the pointer of the given type of an entry
+  template<typename T> static T*& func(Entry& e);
+  template<typename T> static T* func(const Entry& e);
 };
 
 #endif // !defined(ENDGAME_H_INCLUDED)
@@ -0,0 +1,804 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2010 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Generated by "stockfish kpkgen", do not edit. See print_kpk_bitbase()
+// in bitbase.cpp for the retrograde analysis and the index layout.
+
+#if !defined(KPKBITBASE_H_INCLUDED)
+#define KPKBITBASE_H_INCLUDED
+
+#include "types.h"
+
+namespace {
+
+// Each uint32_t stores results of 32 positions, one per bit
+const uint32_t KPKBitbase[6144] = {
+  0xD550FFF0, 0xD000D000, 0xD000D000, 0xD000D000, 0xD540FFC0, 0xD000D000, 0xD000D000, 0xD000D000,
+  0xD500FF01, 0xD000D000, 0xD000D000, 0xD000D000, 0xD404FC05, 0xD000D000, 0xD000D000, 0xD000D000,
+  0xD014F035, 0xD000D000, 0xD000D000, 0xD000D000, 0xC054C0F5, 0xD000D000, 0xD000D000, 0xD000D000,
+  0x015403F5, 0xD000D000, 0xD000D000, 0xD000D000, 0x05540FF5, 0xD000D000, 0xD000D000, 0xD000D000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFC0FFC0, 0xD000D540, 0xD000D000, 0xD000D000,
+  0xFF00FF01, 0xD000D500, 0xD000D000, 0xD000D000, 0xFC04FC05, 0xD000D400, 0xD000D000, 0xD000D000,
+  0xF014F035, 0xD000D000, 0xD000D000, 0xD000D000, 0xC054C0F5, 0xD000C000, 0xD000D000, 0xD000D000,
+  0x015403F5, 0xD0000000, 0xD000D000, 0xD000D000, 0x05540FF5, 0xD0000000, 0xD000D000, 0xD000D000,
+  0xFF50FFFF, 0xD540FF40, 0xD000D000, 0xD000D000, 0xFFC0FFFF, 0xD540FFC0, 0xD000D000, 0xD000D000,
+  0xFF00FFF5, 0xD500FF00, 0xD000D000, 0xD000D000, 0xFC04FFF5, 0xD400FC00, 0xD000D000, 0xD000D000,
+  0xF014FFF5, 0xD000F000, 0xD000D000, 0xD000D000, 0xC054FFF5, 0xC000C000, 0xD000D000, 0xD000D000,
+  0x0154FFF5, 0x00000000, 0xD000D000, 0xD000D000, 0x0554FFF5, 0x00000000, 0xD000D000, 0xD000D000,
+  0xFFF4FFF5, 0xFF40FF50, 0xF400F540, 0xF400F400, 0xFFF4FFF5, 0xFFC0FFC0, 0xF400F540, 0xF400F400,
+  0xFFF4FFF5, 0xFF00FF00, 0xF400F500, 0xF400F400, 0xFFF4FFF5, 0xFC00FC00, 0xF400F400, 0xF400F400,
+  0xFF54FFF5, 0xF000F000, 0xF400F000, 0xF400F400, 0xFD54FFF5, 0xC000C000, 0xD000C000, 0xD000D000,
+  0xF554FFF5, 0x00000000, 0xD0000000, 0xD000D000, 0xD554FFF5, 0x00000000, 0xD0000000, 0xD000D000,
+  0xFFF4FFF5, 0xFF40FF50, 0xFD40FF40, 0xFD00FD00, 0xFFF4FFF5, 0xFFC0FFF0, 0xFD40FFC0, 0xFD00FD00,
+  0xFFF4FFF5, 0xFF00FFF0, 0xFD00FF00, 0xFD00FD00, 0xFFF4FFF5, 0xFC00FFD0, 0xFC00FC00, 0xFD00FD00,
+  0xFF54FFF5, 0xF000FF40, 0xF000F000, 0xF400F400, 0xFD54FFF5, 0xC000FD00, 0xC000C000, 0xD000D000,
+  0xF554FFF5, 0x0000F400, 0x00000000, 0xD000D000, 0xD554FFF5, 0x0000D000, 0x00000000, 0xD000D000,
+  0xFFF4FFF5, 0xFF40FF50, 0xFF40FF40, 0xFF40FF40, 0xFFF4FFF5, 0xFFD0FFD0, 0xFFC0FFC0, 0xFF40FF40,
+  0xFFF4FFF5, 0xFF40FF50, 0xFF00FF00, 0xFF40FF00, 0xFFF4FFF5, 0xFD00FD50, 0xFC00FC00, 0xFD00FC00,
+  0xFF54FFF5, 0xF400F540, 0xF000F000, 0xF400F000, 0xFD54FFF5, 0xD000D500, 0xC000C000, 0xD000C000,
+  0xF554FFF5, 0xD000D400, 0x00000000, 0xD0000000, 0xD554FFF5, 0xD000D000, 0x00000000, 0xD0000000,
+  0xFF54FFF5, 0xFF40FF40, 0xFF40FF40, 0xFF40FF40, 0xFF54FFF5, 0xFF40FF40, 0xFF40FF40, 0xFFC0FFC0,
+  0xFF54FFF5, 0xFF40FF40, 0xFF00FF40, 0xFF00FF00, 0xFD54FFF5, 0xFD00FD00, 0xFC00FD00, 0xFC00FC00,
+  0xF554FFF5, 0xF400F400, 0xF000F400, 0xF000F000, 0xD554FFF5, 0xD000D000, 0xC000D000, 0xC000C000,
+  0xD554FFF5, 0xD000D000, 0x0000D000, 0x00000000, 0xD554FFF5, 0xD000D000, 0x0000D000, 0x00000000,
+  0xFD54FFF5, 0xFD00FD00, 0xFD00FD00, 0xFF40FD40, 0xFD54FFF5, 0xFD00FD00, 0xFD00FD00, 0xFFC0FD40,
+  0xFD54FFF5, 0xFD00FD00, 0xFD00FD00, 0xFF00FD00, 0xFD54FFF5, 0xFD00FD00, 0xFD00FD00, 0xFC00FC00,
+  0xF554FFF5, 0xF400F400, 0xF400F400, 0xF000F000, 0xD554FFF5, 0xD000D000, 0xD000D000, 0xC000C000,
+  0xD554FFF5, 0xD000D000, 0xD000D000, 0x00000000, 0xD554FFF5, 0xD000D000, 0xD000D000, 0x00000000,
+  0xFFD0FFF0, 0xFF40FF40, 0xFF40FF40, 0xFF55FF40, 0xFFC0FFC0, 0xFF40FF40, 0xFF40FF40, 0xFF55FF40,
+  0xFD01FF03, 0xFD00FD00, 0xFD00FD00, 0xFD55FD00, 0xFC01FC05, 0xFD00FD00, 0xFD00FD00, 0xFD55FD00,
+  0xF011F015, 0xF400F400, 0xF400F400, 0xF555F400, 0xC051C0D5, 0xD000D000, 0xD000D000, 0xD555D000,
+  0x015103D5, 0x40004000, 0x40004000, 0x54004000, 0x05510FD5, 0x40004000, 0x40004000, 0x50004000,
+  0xFFF0FFF0, 0xFFD0FFC0, 0xFFD0FFD5, 0xFFFFFFD5, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xFF03FF03, 0xFF41FF00, 0xFF41FF55, 0xFFFFFF55, 0xFC01FC05, 0xFD01FC00, 0xFD01FD51, 0xFFFFFD55,
+  0xF011F015, 0xF400F000, 0xF400F540, 0xFFFFF555, 0xC051C0D5, 0xD000C000, 0xD000D500, 0xFD55D500,
+  0x015103D5, 0x40000000, 0x40005400, 0xF4005400, 0x05510FD5, 0x40000000, 0x40005000, 0xD0005000,
+  0xFFF0FFFF, 0xFFF0FFE0, 0xFFF5FFF6, 0xFFFFFFFF, 0xFFC0FFFF, 0xFFC0FFC0, 0xFFD5FFD9, 0xFFFFFFFF,
+  0xFF03FFFF, 0xFF03FF02, 0xFF57FF67, 0xFFFFFFFF, 0xFC01FFD5, 0xFC01FC00, 0xFD55FD91, 0xFFFFFFFF,
+  0xF011FFD5, 0xF000F000, 0xF540F640, 0xFFFFFF55, 0xC051FFD5, 0xC000C000, 0xD500D900, 0xFD55FD00,
+  0x0151FFD5, 0x00000000, 0x54006400, 0xF400F400, 0x0551FFD5, 0x00000000, 0xD000D000, 0xD000D000,
+  0xFFD1FFD5, 0xFFF0FFC0, 0xFFFFFFF0, 0xFFFFFFFF, 0xFFD1FFD5, 0xFFC0FFC0, 0xFFFFFFC0, 0xFFFFFFFF,
+  0xFFD1FFD5, 0xFF03FF00, 0xFFFFFF03, 0xFFFFFFFF, 0xFFD1FFD5, 0xFC01FC00, 0xFFD5FC01, 0xFFFFFFFF,
+  0xFFD1FFD5, 0xF000F000, 0xFF40F000, 0xFFFFFF55, 0xFD51FFD5, 0xC000C000, 0xFD00C000, 0xFD55FD00,
+  0xF551FFD5, 0x00000000, 0xF4000000, 0xF400F400, 0xD551FFD5, 0x00000000, 0xD0000000, 0xD000D000,
+  0xFFD1FFD5, 0xFFD0FFC0, 0xFFF0FFF0, 0xFFFFFFFF, 0xFFD1FFD5, 0xFFC0FFC0, 0xFFC0FFC0, 0xFFFFFFFF,
+  0xFFD1FFD5, 0xFF01FFC0, 0xFF03FF03, 0xFFFFFFFF, 0xFFD1FFD5, 0xFC01FFC0, 0xFC05FC01, 0xFFFFFFFF,
+  0xFFD1FFD5, 0xF000FF40, 0xF000F000, 0xFFFFFF55, 0xFD51FFD5, 0xC000FD00, 0xC000C000, 0xFD55FD00,
+  0xF551FFD5, 0x0000F400, 0x00000000, 0xF400F400, 0xD551FFD5, 0x0000D000, 0x00000000, 0xD000D000,
+  0xFFD1FFD5, 0xFF40FF40, 0xFFF0FF50, 0xFFFFFFF0, 0xFFD1FFD5, 0xFF40FF40, 0xFFC0FF40, 0xFFFFFFC0,
+  0xFFD1FFD5, 0xFF40FF40, 0xFF03FF01, 0xFFFFFF03, 0xFFD1FFD5, 0xFD00FD40, 0xFC01FC01, 0xFFFFFC05,
+  0xFFD1FFD5, 0xF400F540, 0xF000F000, 0xFFFFF015, 0xFD51FFD5, 0xD000D500, 0xC000C000, 0xFD55C000,
+  0xF551FFD5, 0x40005400, 0x00000000, 0xF4000000, 0xD551FFD5, 0x40005000, 0x00000000, 0xD0000000,
+  0xFD51FFD5, 0xFD00FD00, 0xFD50FD00, 0xFFF0FFF0, 0xFD51FFD5, 0xFD00FD00, 0xFD40FD00, 0xFFC0FFC0,
+  0xFD51FFD5, 0xFD00FD00, 0xFD01FD00, 0xFF03FF03, 0xFD51FFD5, 0xFD00FD00, 0xFC01FD00, 0xFC05FC01,
+  0xF551FFD5, 0xF400F400, 0xF000F400, 0xF015F000, 0xD551FFD5, 0xD000D000, 0xC000D000, 0xC055C000,
+  0x5551FFD5, 0x40004000, 0x00004000, 0x00000000, 0x5551FFD5, 0x40004000, 0x00004000, 0x00000000,
+  0xF551FFD5, 0xF400F400, 0xF400F400, 0xFFF0F550, 0xF551FFD5, 0xF400F400, 0xF400F400, 0xFFC0F540,
+  0xF551FFD5, 0xF400F400, 0xF400F400, 0xFF03F501, 0xF551FFD5, 0xF400F400, 0xF400F400, 0xFC01F401,
+  0xF551FFD5, 0xF400F400, 0xF400F400, 0xF000F000, 0xD551FFD5, 0xD000D000, 0xD000D000, 0xC000C000,
+  0x5551FFD5, 0x40004000, 0x40004000, 0x00000000, 0x5551FFD5, 0x40004000, 0x40004000, 0x00000000,
+  0xFF40FF50, 0xFD00FD00, 0xFD00FD00, 0xFD55FD00, 0xFF40FFC0, 0xFD00FD00, 0xFD00FD00, 0xFD55FD00,
+  0xFF03FF03, 0xFD01FD01, 0xFD01FD01, 0xFD55FD01, 0xF407FC0F, 0xF401F401, 0xF401F401, 0xF555F401,
+  0xF007F017, 0xF401F401, 0xF401F401, 0xF555F401, 0xC047C057, 0xD001D001, 0xD001D001, 0xD555D001,
+  0x01450357, 0x40004000, 0x40004000, 0x55554000, 0x05450F57, 0x00000000, 0x00000000, 0x50000000,
+  0xFF40FF50, 0xFF40FF00, 0xFF40FF45, 0xFFFFFF55, 0xFFC0FFC0, 0xFF41FF00, 0xFF41FF55, 0xFFFFFF55,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFC0FFC0F, 0xFD07FC03, 0xFD07FD57, 0xFFFFFD57,
+  0xF007F017, 0xF407F003, 0xF407F547, 0xFFFFF557, 0xC047C057, 0xD001C001, 0xD001D501, 0xFFFFD555,
+  0x01450357, 0x40000000, 0x40005400, 0xF5555400, 0x05450F57, 0x00000000, 0x00005000, 0xD0005000,
+  0xFF40FF57, 0xFF40FF00, 0xFF55FF46, 0xFFFFFFFF, 0xFFC0FFFF, 0xFFC0FF80, 0xFFD5FFD9, 0xFFFFFFFF,
+  0xFF03FFFF, 0xFF03FF03, 0xFF57FF67, 0xFFFFFFFF, 0xFC0FFFFF, 0xFC0FFC0B, 0xFD5FFD9F, 0xFFFFFFFF,
+  0xF007FF57, 0xF007F003, 0xF557F647, 0xFFFFFFFF, 0xC047FF57, 0xC001C001, 0xD501D901, 0xFFFFFD55,
+  0x0145FF57, 0x00000000, 0x54006400, 0xF555F400, 0x0545FF57, 0x00000000, 0x50009000, 0xD000D000,
+  0xFF47FF57, 0xFF40FF00, 0xFF57FF40, 0xFFFFFFFF, 0xFF47FF57, 0xFFC0FF00, 0xFFFFFFC0, 0xFFFFFFFF,
+  0xFF47FF57, 0xFF03FF03, 0xFFFFFF03, 0xFFFFFFFF, 0xFF47FF57, 0xFC0FFC03, 0xFFFFFC0F, 0xFFFFFFFF,
+  0xFF47FF57, 0xF007F003, 0xFF57F007, 0xFFFFFFFF, 0xFF47FF57, 0xC001C001, 0xFD01C001, 0xFFFFFD55,
+  0xF545FF57, 0x00000000, 0xF4000000, 0xF555F400, 0xD545FF57, 0x00000000, 0xD0000000, 0xD000D000,
+  0xFF47FF57, 0xFF40FF03, 0xFF50FF40, 0xFFFFFFFF, 0xFF47FF57, 0xFF40FF03, 0xFFC0FFC0, 0xFFFFFFFF,
+  0xFF47FF57, 0xFF03FF03, 0xFF03FF03, 0xFFFFFFFF, 0xFF47FF57, 0xFC07FF03, 0xFC0FFC0F, 0xFFFFFFFF,
+  0xFF47FF57, 0xF007FF03, 0xF017F007, 0xFFFFFFFF, 0xFF47FF57, 0xC001FD01, 0xC001C001, 0xFFFFFD55,
+  0xF545FF57, 0x0000F400, 0x00000000, 0xF555F400, 0xD545FF57, 0x0000D000, 0x00000000, 0xD000D000,
+  0xFF47FF57, 0xFD00FD01, 0xFF40FD40, 0xFFFFFF50, 0xFF47FF57, 0xFD01FD01, 0xFFC0FD40, 0xFFFFFFC0,
+  0xFF47FF57, 0xFD01FD01, 0xFF03FD01, 0xFFFFFF03, 0xFF47FF57, 0xFD01FD01, 0xFC0FFC05, 0xFFFFFC0F,
+  0xFF47FF57, 0xF401F501, 0xF007F005, 0xFFFFF017, 0xFF47FF57, 0xD001D501, 0xC001C001, 0xFFFFC055,
+  0xF545FF57, 0x40005400, 0x00000000, 0xF5550000, 0xD545FF57, 0x00005000, 0x00000000, 0xD0000000,
+  0xF545FF57, 0xF400F400, 0xF540F400, 0xFF50FF40, 0xF545FF57, 0xF400F400, 0xF540F400, 0xFFC0FFC0,
+  0xF545FF57, 0xF400F400, 0xF501F400, 0xFF03FF03, 0xF545FF57, 0xF400F400, 0xF405F400, 0xFC0FFC0F,
+  0xF545FF57, 0xF400F400, 0xF005F400, 0xF017F007, 0xD545FF57, 0xD000D000, 0xC001D000, 0xC055C001,
+  0x5545FF57, 0x40004000, 0x00004000, 0x01550000, 0x5545FF57, 0x00000000, 0x00000000, 0x00000000,
+  0xD545FF57, 0xD000D000, 0xD000D000, 0xFF40D540, 0xD545FF57, 0xD000D000, 0xD000D000, 0xFFC0D540,
+  0xD545FF57, 0xD000D000, 0xD000D000, 0xFF03D501, 0xD545FF57, 0xD000D000, 0xD000D000, 0xFC0FD405,
+  0xD545FF57, 0xD000D000, 0xD000D000, 0xF007D005, 0xD545FF57, 0xD000D000, 0xD000D000, 0xC001C001,
+  0x5545FF57, 0x40004000, 0x40004000, 0x00000000, 0x5545FF57, 0x00000000, 0x00000000, 0x00000000,
+  0xFD10FD50, 0xF400F400, 0xF400F400, 0xF555F400, 0xFD00FD40, 0xF401F401, 0xF401F401, 0xF555F401,
+  0xFD01FF03, 0xF401F401, 0xF401F401, 0xF555F401, 0xFC0FFC0F, 0xF407F407, 0xF407F407, 0xF557F407,
+  0xD01FF03F, 0xD007D007, 0xD007D007, 0xD557D007, 0xC01FC05F, 0xD007D007, 0xD007D007, 0xD557D007,
+  0x011F015F, 0x40074007, 0x40074007, 0x55574007, 0x05150D5F, 0x00010001, 0x00010001, 0x55550001,
+  0xFD10FD50, 0xF400F400, 0xF400F405, 0xFFFFF555, 0xFD00FD40, 0xFD01FC00, 0xFD01FD15, 0xFFFFFD55,
+  0xFF03FF03, 0xFD07FC03, 0xFD07FD57, 0xFFFFFD57, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xF03FF03F, 0xF41FF00F, 0xF41FF55F, 0xFFFFF55F, 0xC01FC05F, 0xD01FC00F, 0xD01FD51F, 0xFFFFD55F,
+  0x011F015F, 0x40070007, 0x40075407, 0xFFFF5557, 0x05150D5F, 0x00010001, 0x00015001, 0xD5555001,
+  0xFD10FD5F, 0xF400F400, 0xF405F406, 0xFFFFF557, 0xFD00FD5F, 0xFD00FC00, 0xFD55FD19, 0xFFFFFFFF,
+  0xFF03FFFF, 0xFF03FE03, 0xFF57FF67, 0xFFFFFFFF, 0xFC0FFFFF, 0xFC0FFC0F, 0xFD5FFD9F, 0xFFFFFFFF,
+  0xF03FFFFF, 0xF03FF02F, 0xF57FF67F, 0xFFFFFFFF, 0xC01FFD5F, 0xC01FC00F, 0xD55FD91F, 0xFFFFFFFF,
+  0x011FFD5F, 0x00070007, 0x54076407, 0xFFFFF557, 0x0515FD5F, 0x00010001, 0x50019001, 0xD555D001,
+  0xFD1FFD5F, 0xF400F400, 0xF407F400, 0xFFFFF557, 0xFD1FFD5F, 0xFD00FC00, 0xFD5FFD00, 0xFFFFFFFF,
+  0xFD1FFD5F, 0xFF03FC03, 0xFFFFFF03, 0xFFFFFFFF, 0xFD1FFD5F, 0xFC0FFC0F, 0xFFFFFC0F, 0xFFFFFFFF,
+  0xFD1FFD5F, 0xF03FF00F, 0xFFFFF03F, 0xFFFFFFFF, 0xFD1FFD5F, 0xC01FC00F, 0xFD5FC01F, 0xFFFFFFFF,
+  0xFD1FFD5F, 0x00070007, 0xF4070007, 0xFFFFF557, 0xD515FD5F, 0x00010001, 0xD0010001, 0xD555D001,
+  0xFD1FFD5F, 0xF400F407, 0xF400F400, 0xFFFFF557, 0xFD1FFD5F, 0xFD00FC0F, 0xFD40FD00, 0xFFFFFFFF,
+  0xFD1FFD5F, 0xFD03FC0F, 0xFF03FF03, 0xFFFFFFFF, 0xFD1FFD5F, 0xFC0FFC0F, 0xFC0FFC0F, 0xFFFFFFFF,
+  0xFD1FFD5F, 0xF01FFC0F, 0xF03FF03F, 0xFFFFFFFF, 0xFD1FFD5F, 0xC01FFC0F, 0xC05FC01F, 0xFFFFFFFF,
+  0xFD1FFD5F, 0x0007F407, 0x00070007, 0xFFFFF557, 0xD515FD5F, 0x0001D001, 0x00010001, 0xD555D001,
+  0xFD1FFD5F, 0xF400F405, 0xF400F400, 0xFFFFF550, 0xFD1FFD5F, 0xF401F405, 0xFD00F500, 0xFFFFFD40,
+  0xFD1FFD5F, 0xF407F407, 0xFF03F503, 0xFFFFFF03, 0xFD1FFD5F, 0xF407F407, 0xFC0FF407, 0xFFFFFC0F,
+  0xFD1FFD5F, 0xF407F407, 0xF03FF017, 0xFFFFF03F, 0xFD1FFD5F, 0xD007D407, 0xC01FC017, 0xFFFFC05F,
+  0xFD1FFD5F, 0x40075407, 0x00070007, 0xFFFF0157, 0xD515FD5F, 0x00015001, 0x00010001, 0xD5550001,
+  0xD515FD5F, 0xD000D000, 0xD400D000, 0xF550F400, 0xD515FD5F, 0xD001D001, 0xD500D001, 0xFD40FD00,
+  0xD515FD5F, 0xD001D001, 0xD501D001, 0xFF03FF03, 0xD515FD5F, 0xD001D001, 0xD405D001, 0xFC0FFC0F,
+  0xD515FD5F, 0xD001D001, 0xD015D001, 0xF03FF03F, 0xD515FD5F, 0xD001D001, 0xC015D001, 0xC05FC01F,
+  0x5515FD5F, 0x40014001, 0x00054001, 0x01570007, 0x5515FD5F, 0x00010001, 0x00010001, 0x05550001,
+  0x5515FD5F, 0x40004000, 0x40004000, 0xF4005400, 0x5515FD5F, 0x40004000, 0x40004000, 0xFD005500,
+  0x5515FD5F, 0x40004000, 0x40004000, 0xFF035501, 0x5515FD5F, 0x40004000, 0x40004000, 0xFC0F5405,
+  0x5515FD5F, 0x40004000, 0x40004000, 0xF03F5015, 0x5515FD5F, 0x40004000, 0x40004000, 0xC01F4015,
+  0x5515FD5F, 0x40004000, 0x40004000, 0x00070005, 0x5515FD5F, 0x00000000, 0x00000000, 0x00010001,
+  0xD550FFF0, 0xD000D000, 0xD000D000, 0xD000D000, 0xD540FFC0, 0xD000D000, 0xD000D000, 0xD000D000,
+  0xD501FF03, 0xD000D000, 0xD000D000, 0xD000D000, 0xD405FC0F, 0xD000D000, 0xD000D000, 0xD000D000,
+  0xD015F03F, 0xD000D000, 0xD000D000, 0xD000D000, 0xC055C0FF, 0xD000D000, 0xD000D000, 0xD000D000,
+  0x015503FF, 0xD000D000, 0xD000D000, 0xD000D000, 0x05550FFF, 0xD000D000, 0xD000D000, 0xD000D000,
+  0xFF50FFF0, 0xD000D540, 0xD000D000, 0xD000D000, 0xFFC0FFC0, 0xD000D540, 0xD000D000, 0xD000D000,
+  0xFF01FF03, 0xD000D500, 0xD000D000, 0xD000D000, 0xFC05FC0F, 0xD000D400, 0xD000D000, 0xD000D000,
+  0xF015F03F, 0xD000D000, 0xD000D000, 0xD000D000, 0xC055C0FF, 0xD000C000, 0xD000D000, 0xD000D000,
+  0x015503FF, 0xD0000000, 0xD000D000, 0xD000D000, 0x05550FFF, 0xD0000000, 0xD000D000, 0xD000D000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFC0FFFF, 0xD540FFC0, 0xD000D000, 0xD000D000,
+  0xFF01FFFF, 0xD500FF00, 0xD000D000, 0xD000D000, 0xFC05FFFF, 0xD400FC00, 0xD000D000, 0xD000D000,
+  0xF015FFFF, 0xD000F000, 0xD000D000, 0xD000D000, 0xC055FFFF, 0xC000C000, 0xD000D000, 0xD000D000,
+  0x0155FFFF, 0x00000000, 0xD000D000, 0xD000D000, 0x0555FFFF, 0x00000000, 0xD000D000, 0xD000D000,
+  0xFFFFFFFF, 0xFF40FF50, 0xF400F540, 0xF400F400, 0xFFFFFFFF, 0xFFC0FFC0, 0xF400F540, 0xF400F400,
+  0xFFF5FFFF, 0xFF00FF00, 0xF400F500, 0xF400F400, 0xFFD5FFFF, 0xFC00FC00, 0xF400F400, 0xF400F400,
+  0xFF55FFFF, 0xF000F000, 0xF400F000, 0xF400F400, 0xFD55FFFF, 0xC000C000, 0xD000C000, 0xD000D000,
+  0xF555FFFF, 0x00000000, 0xD0000000, 0xD000D000, 0xD555FFFF, 0x00000000, 0xD0000000, 0xD000D000,
+  0xFFF5FFFF, 0xFF40FF54, 0xFD40FF40, 0xFD00FD00, 0xFFF5FFFF, 0xFFC0FFF4, 0xFD40FFC0, 0xFD00FD00,
+  0xFFD5FFFF, 0xFF00FFD0, 0xFD00FF00, 0xFD00FD00, 0xFF55FFFF, 0xFC00FF40, 0xFC00FC00, 0xFD00FD00,
+  0xFD55FFFF, 0xF000FD00, 0xF000F000, 0xF400F400, 0xF555FFFF, 0xC000F400, 0xC000C000, 0xD000D000,
+  0xD555FFFF, 0x0000D000, 0x00000000, 0xD000D000, 0xD555FFFF, 0x0000D000, 0x00000000, 0xD000D000,
+  0xFFD5FFFF, 0xFF40FF50, 0xFF40FF40, 0xFF40FF40, 0xFFD5FFFF, 0xFFD0FFD0, 0xFFC0FFC0, 0xFF40FF40,
+  0xFFD5FFFF, 0xFF40FF50, 0xFF00FF00, 0xFF40FF00, 0xFF55FFFF, 0xFD00FD40, 0xFC00FC00, 0xFD00FC00,
+  0xFD55FFFF, 0xF400F500, 0xF000F000, 0xF400F000, 0xF555FFFF, 0xD000D400, 0xC000C000, 0xD000C000,
+  0xD555FFFF, 0xD000D000, 0x00000000, 0xD0000000, 0xD555FFFF, 0xD000D000, 0x00000000, 0xD0000000,
+  0xFF55FFFF, 0xFF40FF40, 0xFF40FF40, 0xFF40FF40, 0xFF55FFFF, 0xFF40FF40, 0xFF40FF40, 0xFFC0FFC0,
+  0xFF55FFFF, 0xFF40FF40, 0xFF00FF40, 0xFF00FF00, 0xFD55FFFF, 0xFD00FD00, 0xFC00FD00, 0xFC00FC00,
+  0xF555FFFF, 0xF400F400, 0xF000F400, 0xF000F000, 0xD555FFFF, 0xD000D000, 0xC000D000, 0xC000C000,
+  0xD555FFFF, 0xD000D000, 0x0000D000, 0x00000000, 0xD555FFFF, 0xD000D000, 0x0000D000, 0x00000000,
+  0xFD55FFFF, 0xFD00FD00, 0xFD00FD00, 0xFF40FD40, 0xFD55FFFF, 0xFD00FD00, 0xFD00FD00, 0xFFC0FD40,
+  0xFD55FFFF, 0xFD00FD00, 0xFD00FD00, 0xFF00FD00, 0xFD55FFFF, 0xFD00FD00, 0xFD00FD00, 0xFC00FC00,
+  0xF555FFFF, 0xF400F400, 0xF400F400, 0xF000F000, 0xD555FFFF, 0xD000D000, 0xD000D000, 0xC000C000,
+  0xD555FFFF, 0xD000D000, 0xD000D000, 0x00000000, 0xD555FFFF, 0xD000D000, 0xD000D000, 0x00000000,
+  0xFF50FFF0, 0xFD00FD40, 0xFD00FD00, 0xFD00FD00, 0xFF40FFC0, 0xFD00FD40, 0xFD00FD00, 0xFD00FD00,
+  0xFF01FF03, 0xFD00FD40, 0xFD00FD00, 0xFD00FD00, 0xF405FC0F, 0xF400F400, 0xF400F400, 0xF400F400,
+  0xF015F03F, 0xF400F400, 0xF400F400, 0xF400F400, 0xC055C0FF, 0xD000D000, 0xD000D000, 0xD000D000,
+  0x015503FF, 0x40004000, 0x40004000, 0x40004000, 0x05550FFF, 0x40004000, 0x40004000, 0x40004000,
+  0xFFF0FFF0, 0xFF40FFD0, 0xFF40FF40, 0xFF40FF40, 0xFFC0FFC0, 0xFF40FFC0, 0xFF40FF40, 0xFF40FF40,
+  0xFF03FF03, 0xFD00FD01, 0xFD00FD00, 0xFD00FD00, 0xFC05FC0F, 0xFD00FC01, 0xFD00FD00, 0xFD00FD00,
+  0xF015F03F, 0xF400F000, 0xF400F400, 0xF400F400, 0xC055C0FF, 0xD000C000, 0xD000D000, 0xD000D000,
+  0x015503FF, 0x40000000, 0x40004000, 0x40004000, 0x05550FFF, 0x40000000, 0x40004000, 0x40004000,
+  0xFFF0FFFF, 0xFFC0FFF0, 0xFFD5FFD0, 0xFFD5FFD0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xFF03FFFF, 0xFF00FF03, 0xFF55FF41, 0xFF55FF41, 0xFC05FFFF, 0xFC00FC01, 0xFD51FD01, 0xFD55FD01,
+  0xF015FFFF, 0xF000F000, 0xF540F400, 0xF555F400, 0xC055FFFF, 0xC000C000, 0xD500D000, 0xD500D000,
+  0x0155FFFF, 0x00000000, 0x54004000, 0x54004000, 0x0555FFFF, 0x00000000, 0x50004000, 0x50004000,
+  0xFFFFFFFF, 0xFFE0FFF0, 0xFFF6FFF0, 0xFFFFFFF5, 0xFFFFFFFF, 0xFFC0FFC0, 0xFFD9FFC0, 0xFFFFFFD5,
+  0xFFFFFFFF, 0xFF02FF03, 0xFF67FF03, 0xFFFFFF57, 0xFFD5FFFF, 0xFC00FC01, 0xFD91FC01, 0xFFFFFD55,
+  0xFF55FFFF, 0xF000F000, 0xF640F000, 0xFF55F540, 0xFD55FFFF, 0xC000C000, 0xD900C000, 0xFD00D500,
+  0xF555FFFF, 0x00000000, 0x64000000, 0xF4005400, 0xD555FFFF, 0x00000000, 0xD0000000, 0xD000D000,
+  0xFFD5FFFF, 0xFFC0FFD1, 0xFFF0FFF0, 0xFFFFFFFF, 0xFFD5FFFF, 0xFFC0FFD1, 0xFFC0FFC0, 0xFFFFFFFF,
+  0xFFD5FFFF, 0xFF00FFD1, 0xFF03FF03, 0xFFFFFFFF, 0xFF55FFFF, 0xFC00FF41, 0xFC01FC01, 0xFFFFFFD5,
+  0xFD55FFFF, 0xF000FD00, 0xF000F000, 0xFF55FF40, 0xF555FFFF, 0xC000F400, 0xC000C000, 0xFD00FD00,
+  0xD555FFFF, 0x0000D000, 0x00000000, 0xF400F400, 0x5555FFFF, 0x00004000, 0x00000000, 0xD000D000,
+  0xFF55FFFF, 0xFF40FF40, 0xFFF0FFD0, 0xFFFFFFF0, 0xFF55FFFF, 0xFF40FF40, 0xFFC0FFC0, 0xFFFFFFC0,
+  0xFF55FFFF, 0xFF40FF40, 0xFF03FF01, 0xFFFFFF03, 0xFF55FFFF, 0xFD00FD40, 0xFC01FC01, 0xFFFFFC05,
+  0xFD55FFFF, 0xF400F500, 0xF000F000, 0xFF55F000, 0xF555FFFF, 0xD000D400, 0xC000C000, 0xFD00C000,
+  0xD555FFFF, 0x40005000, 0x00000000, 0xF4000000, 0x5555FFFF, 0x40004000, 0x00000000, 0xD0000000,
+  0xFD55FFFF, 0xFD00FD00, 0xFF50FD40, 0xFFF0FFF0, 0xFD55FFFF, 0xFD00FD00, 0xFF40FD40, 0xFFC0FFC0,
+  0xFD55FFFF, 0xFD00FD00, 0xFF01FD40, 0xFF03FF03, 0xFD55FFFF, 0xFD00FD00, 0xFC01FD00, 0xFC05FC01,
+  0xF555FFFF, 0xF400F400, 0xF000F400, 0xF015F000, 0xD555FFFF, 0xD000D000, 0xC000D000, 0xC000C000,
+  0x5555FFFF, 0x40004000, 0x00004000, 0x00000000, 0x5555FFFF, 0x40004000, 0x00004000, 0x00000000,
+  0xF555FFFF, 0xF400F400, 0xF500F400, 0xFFF0FD50, 0xF555FFFF, 0xF400F400, 0xF500F400, 0xFFC0FD40,
+  0xF555FFFF, 0xF400F400, 0xF500F400, 0xFF03FD01, 0xF555FFFF, 0xF400F400, 0xF500F400, 0xFC01FC01,
+  0xF555FFFF, 0xF400F400, 0xF400F400, 0xF000F000, 0xD555FFFF, 0xD000D000, 0xD000D000, 0xC000C000,
+  0x5555FFFF, 0x40004000, 0x40004000, 0x00000000, 0x5555FFFF, 0x40004000, 0x40004000, 0x00000000,
+  0xFD50FFF0, 0xF400F500, 0xF400F400, 0xF400F400, 0xFD40FFC0, 0xF400F501, 0xF400F400, 0xF400F400,
+  0xFD01FF03, 0xF400F501, 0xF400F400, 0xF400F400, 0xFC05FC0F, 0xF400F501, 0xF400F400, 0xF400F400,
+  0xD015F03F, 0xD000D001, 0xD000D000, 0xD000D000, 0xC055C0FF, 0xD000D001, 0xD000D000, 0xD000D000,
+  0x015503FF, 0x40004000, 0x40004000, 0x40004000, 0x05550FFF, 0x00000000, 0x00000000, 0x00000000,
+  0xFF50FFF0, 0xFD00FF40, 0xFD00FD00, 0xFD00FD00, 0xFFC0FFC0, 0xFD00FF40, 0xFD00FD00, 0xFD00FD00,
+  0xFF03FF03, 0xFD01FF03, 0xFD01FD01, 0xFD01FD01, 0xFC0FFC0F, 0xF401F407, 0xF401F401, 0xF401F401,
+  0xF017F03F, 0xF401F007, 0xF401F401, 0xF401F401, 0xC055C0FF, 0xD001C001, 0xD001D001, 0xD001D001,
+  0x015503FF, 0x40000000, 0x40004000, 0x40004000, 0x05550FFF, 0x00000000, 0x00000000, 0x00000000,
+  0xFF50FFFF, 0xFF00FF40, 0xFF45FF40, 0xFF55FF40, 0xFFC0FFFF, 0xFF00FFC0, 0xFF55FF41, 0xFF55FF41,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFC0FFFFF, 0xFC03FC0F, 0xFD57FD07, 0xFD57FD07,
+  0xF017FFFF, 0xF003F007, 0xF547F407, 0xF557F407, 0xC055FFFF, 0xC001C001, 0xD501D001, 0xD555D001,
+  0x0155FFFF, 0x00000000, 0x54004000, 0x54004000, 0x0555FFFF, 0x00000000, 0x50000000, 0x50000000,
+  0xFF57FFFF, 0xFF00FF40, 0xFF46FF40, 0xFFFFFF55, 0xFFFFFFFF, 0xFF80FFC0, 0xFFD9FFC0, 0xFFFFFFD5,
+  0xFFFFFFFF, 0xFF03FF03, 0xFF67FF03, 0xFFFFFF57, 0xFFFFFFFF, 0xFC0BFC0F, 0xFD9FFC0F, 0xFFFFFD5F,
+  0xFF57FFFF, 0xF003F007, 0xF647F007, 0xFFFFF557, 0xFD55FFFF, 0xC001C001, 0xD901C001, 0xFD55D501,
+  0xF555FFFF, 0x00000000, 0x64000000, 0xF4005400, 0xD555FFFF, 0x00000000, 0x90000000, 0xD0005000,
+  0xFF55FFFF, 0xFF00FF41, 0xFF40FF40, 0xFFFFFF57, 0xFF57FFFF, 0xFF00FF47, 0xFFC0FFC0, 0xFFFFFFFF,
+  0xFF57FFFF, 0xFF03FF47, 0xFF03FF03, 0xFFFFFFFF, 0xFF57FFFF, 0xFC03FF47, 0xFC0FFC0F, 0xFFFFFFFF,
+  0xFD57FFFF, 0xF003FD07, 0xF007F007, 0xFFFFFF57, 0xF555FFFF, 0xC001F401, 0xC001C001, 0xFD55FD01,
+  0xD555FFFF, 0x0000D000, 0x00000000, 0xF400F400, 0x5555FFFF, 0x00004000, 0x00000000, 0xD000D000,
+  0xFD55FFFF, 0xFD00FD01, 0xFF40FF40, 0xFFFFFF50, 0xFD55FFFF, 0xFD01FD01, 0xFFC0FF40, 0xFFFFFFC0,
+  0xFD55FFFF, 0xFD01FD01, 0xFF03FF03, 0xFFFFFF03, 0xFD55FFFF, 0xFD01FD01, 0xFC0FFC07, 0xFFFFFC0F,
+  0xFD55FFFF, 0xF401F501, 0xF007F007, 0xFFFFF017, 0xF555FFFF, 0xD001D401, 0xC001C001, 0xFD55C001,
+  0xD555FFFF, 0x40005000, 0x00000000, 0xF4000000, 0x5555FFFF, 0x00004000, 0x00000000, 0xD0000000,
+  0xF555FFFF, 0xF400F400, 0xFD40F500, 0xFF50FF40, 0xF555FFFF, 0xF400F400, 0xFD40F501, 0xFFC0FFC0,
+  0xF555FFFF, 0xF400F400, 0xFD01F501, 0xFF03FF03, 0xF555FFFF, 0xF400F400, 0xFC05F501, 0xFC0FFC0F,
+  0xF555FFFF, 0xF400F400, 0xF005F401, 0xF017F007, 0xD555FFFF, 0xD000D000, 0xC001D001, 0xC055C001,
+  0x5555FFFF, 0x40004000, 0x00004000, 0x00000000, 0x5555FFFF, 0x00000000, 0x00000000, 0x00000000,
+  0xD555FFFF, 0xD000D000, 0xD400D000, 0xFF40F540, 0xD555FFFF, 0xD000D000, 0xD400D000, 0xFFC0F540,
+  0xD555FFFF, 0xD000D000, 0xD400D000, 0xFF03F501, 0xD555FFFF, 0xD000D000, 0xD400D000, 0xFC0FF405,
+  0xD555FFFF, 0xD000D000, 0xD400D000, 0xF007F005, 0xD555FFFF, 0xD000D000, 0xD000D000, 0xC001C001,
+  0x5555FFFF, 0x40004000, 0x40004000, 0x00000000, 0x5555FFFF, 0x00000000, 0x00000000, 0x00000000,
+  0xF550FFF0, 0xD000D400, 0xD000D000, 0xD000D000, 0xF540FFC0, 0xD000D400, 0xD000D000, 0xD000D000,
+  0xF503FF03, 0xD001D405, 0xD001D001, 0xD001D001, 0xF407FC0F, 0xD001D405, 0xD001D001, 0xD001D001,
+  0xF017F03F, 0xD001D405, 0xD001D001, 0xD001D001, 0x4057C0FF, 0x40014005, 0x40014001, 0x40014001,
+  0x015703FF, 0x40014005, 0x40014001, 0x40014001, 0x05550FFF, 0x00010001, 0x00010001, 0x00010001,
+  0xF550FFF0, 0xF400F400, 0xF400F400, 0xF400F400, 0xFD40FFC0, 0xF401FD00, 0xF401F401, 0xF401F401,
+  0xFF03FF03, 0xF401FD01, 0xF401F401, 0xF401F401, 0xFC0FFC0F, 0xF407FC0F, 0xF407F407, 0xF407F407,
+  0xF03FF03F, 0xD007D01F, 0xD007D007, 0xD007D007, 0xC05FC0FF, 0xD007C01F, 0xD007D007, 0xD007D007,
+  0x015703FF, 0x40070007, 0x40074007, 0x40074007, 0x05550FFF, 0x00010001, 0x00010001, 0x00010001,
+  0xF550FFFF, 0xF400F400, 0xF405F400, 0xF555F400, 0xFD40FFFF, 0xFC00FD00, 0xFD15FD01, 0xFD55FD01,
+  0xFF03FFFF, 0xFC03FF03, 0xFD57FD07, 0xFD57FD07, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xF03FFFFF, 0xF00FF03F, 0xF55FF41F, 0xF55FF41F, 0xC05FFFFF, 0xC00FC01F, 0xD51FD01F, 0xD55FD01F,
+  0x0157FFFF, 0x00070007, 0x54074007, 0x55574007, 0x0555FFFF, 0x00010001, 0x50010001, 0x50010001,
+  0xF557FFFF, 0xF400F400, 0xF406F400, 0xF557F405, 0xFD5FFFFF, 0xFC00FD00, 0xFD19FD00, 0xFFFFFD55,
+  0xFFFFFFFF, 0xFE03FF03, 0xFF67FF03, 0xFFFFFF57, 0xFFFFFFFF, 0xFC0FFC0F, 0xFD9FFC0F, 0xFFFFFD5F,
+  0xFFFFFFFF, 0xF02FF03F, 0xF67FF03F, 0xFFFFF57F, 0xFD5FFFFF, 0xC00FC01F, 0xD91FC01F, 0xFFFFD55F,
+  0xF557FFFF, 0x00070007, 0x64070007, 0xF5575407, 0xD555FFFF, 0x00010001, 0x90010001, 0xD0015001,
+  0xF555FFFF, 0xF400F401, 0xF400F400, 0xF557F407, 0xFD57FFFF, 0xFC00FD07, 0xFD00FD00, 0xFFFFFD5F,
+  0xFD5FFFFF, 0xFC03FD1F, 0xFF03FF03, 0xFFFFFFFF, 0xFD5FFFFF, 0xFC0FFD1F, 0xFC0FFC0F, 0xFFFFFFFF,
+  0xFD5FFFFF, 0xF00FFD1F, 0xF03FF03F, 0xFFFFFFFF, 0xF55FFFFF, 0xC00FF41F, 0xC01FC01F, 0xFFFFFD5F,
+  0xD557FFFF, 0x0007D007, 0x00070007, 0xF557F407, 0x5555FFFF, 0x00014001, 0x00010001, 0xD001D001,
+  0xF555FFFF, 0xF400F401, 0xF400F400, 0xF557F400, 0xF557FFFF, 0xF401F405, 0xFD00FD00, 0xFFFFFD40,
+  0xF557FFFF, 0xF407F407, 0xFF03FD03, 0xFFFFFF03, 0xF557FFFF, 0xF407F407, 0xFC0FFC0F, 0xFFFFFC0F,
+  0xF557FFFF, 0xF407F407, 0xF03FF01F, 0xFFFFF03F, 0xF557FFFF, 0xD007D407, 0xC01FC01F, 0xFFFFC05F,
+  0xD557FFFF, 0x40075007, 0x00070007, 0xF5570007, 0x5555FFFF, 0x00014001, 0x00010001, 0xD0010001,
+  0xD555FFFF, 0xD000D000, 0xF400D400, 0xF550F400, 0xD555FFFF, 0xD001D001, 0xF500D401, 0xFD40FD00,
+  0xD555FFFF, 0xD001D001, 0xF503D405, 0xFF03FF03, 0xD555FFFF, 0xD001D001, 0xF407D405, 0xFC0FFC0F,
+  0xD555FFFF, 0xD001D001, 0xF017D405, 0xF03FF03F, 0xD555FFFF, 0xD001D001, 0xC017D005, 0xC05FC01F,
+  0x5555FFFF, 0x40014001, 0x00074005, 0x01570007, 0x5555FFFF, 0x00010001, 0x00010001, 0x00010001,
+  0x5555FFFF, 0x40004000, 0x50004000, 0xF400D400, 0x5555FFFF, 0x40004000, 0x50014000, 0xFD00D500,
+  0x5555FFFF, 0x40004000, 0x50014000, 0xFF03D501, 0x5555FFFF, 0x40004000, 0x50014000, 0xFC0FD405,
+  0x5555FFFF, 0x40004000, 0x50014000, 0xF03FD015, 0x5555FFFF, 0x40004000, 0x50014000, 0xC01FC015,
+  0x5555FFFF, 0x40004000, 0x40014000, 0x00070005, 0x5555FFFF, 0x00000000, 0x00010000, 0x00010001,
+  0xFFF0FFF0, 0xF400F555, 0xF400F400, 0xF400F400, 0xFFC0FFC0, 0xF400F555, 0xF400F400, 0xF400F400,
+  0xFF03FF03, 0xF400F555, 0xF400F400, 0xF400F400, 0xFC0FFC0F, 0xF400F555, 0xF400F400, 0xF400F400,
+  0xF03FF03F, 0xF400F555, 0xF400F400, 0xF400F400, 0xC0FFC0FF, 0xF400F555, 0xF400F400, 0xF400F400,
+  0x03FF03FF, 0xF400F555, 0xF400F400, 0xF400F400, 0x0FFF0FFF, 0xF400F555, 0xF400F400, 0xF400F400,
+  0xFFF0FFF0, 0xF400F550, 0xF400F400, 0xF400F400, 0xFFC0FFC0, 0xF400F540, 0xF400F400, 0xF400F400,
+  0xFF03FF03, 0xF400F501, 0xF400F400, 0xF400F400, 0xFC0FFC0F, 0xF400F405, 0xF400F400, 0xF400F400,
+  0xF03FF03F, 0xF400F015, 0xF400F400, 0xF400F400, 0xC0FFC0FF, 0xF400C055, 0xF400F400, 0xF400F400,
+  0x03FF03FF, 0xF4000155, 0xF400F400, 0xF400F400, 0x0FFF0FFF, 0xF4000555, 0xF400F400, 0xF400F400,
+  0xFFF0FFFF, 0xF540FF50, 0xF400F400, 0xF400F400, 0xFFC0FFFF, 0xF540FFC0, 0xF400F400, 0xF400F400,
+  0xFF03FFFF, 0xF500FF01, 0xF400F400, 0xF400F400, 0xFC0FFFFF, 0xF400FC05, 0xF400F400, 0xF400F400,
+  0xF03FFFFF, 0xF000F015, 0xF400F400, 0xF400F400, 0xC0FFFFFF, 0xC000C055, 0xF400F400, 0xF400F400,
+  0x03FFFFFF, 0x00000155, 0xF400F400, 0xF400F400, 0x0FFFFFFF, 0x04000555, 0xF400F400, 0xF400F400,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xFFC0FFC0, 0xF400F540, 0xF400F400,
+  0xFFFFFFFF, 0xFF00FF01, 0xF400F500, 0xF400F400, 0xFFFFFFFF, 0xFC00FC05, 0xF400F400, 0xF400F400,
+  0xFFFFFFFF, 0xF000F015, 0xF400F000, 0xF400F400, 0xFFFFFFFF, 0xC000C055, 0xF400C000, 0xF400F400,
+  0xFFFFFFFF, 0x00000155, 0xF4000000, 0xF400F400, 0xFFFFFFFF, 0x04000555, 0xF4000400, 0xF400F400,
+  0xFFFFFFFF, 0xFF50FFFF, 0xFD40FF40, 0xFD00FD00, 0xFFFFFFFF, 0xFFC0FFFF, 0xFD40FFC0, 0xFD00FD00,
+  0xFFFFFFFF, 0xFF00FFF5, 0xFD00FF00, 0xFD00FD00, 0xFFFFFFFF, 0xFC00FFD5, 0xFC00FC00, 0xFD00FD00,
+  0xFFFFFFFF, 0xF000FF55, 0xF000F000, 0xF400F400, 0xFFFFFFFF, 0xC000FD55, 0xC000C000, 0xF400F400,
+  0xFFFFFFFF, 0x0000F555, 0x00000000, 0xF400F400, 0xFFFFFFFF, 0x0400F555, 0x04000400, 0xF400F400,
+  0xFFFFFFFF, 0xFF54FFF5, 0xFF40FF40, 0xFF40FF40, 0xFFFFFFFF, 0xFFF4FFF5, 0xFFC0FFC0, 0xFF40FF40,
+  0xFFFFFFFF, 0xFFD0FFD5, 0xFF00FF00, 0xFF40FF00, 0xFFFFFFFF, 0xFF40FF55, 0xFC00FC00, 0xFD00FC00,
+  0xFFFFFFFF, 0xFD00FD55, 0xF000F000, 0xF400F000, 0xFFFFFFFF, 0xF400F555, 0xC000C000, 0xF400C000,
+  0xFFFFFFFF, 0xF400F555, 0x00000000, 0xF4000000, 0xFFFFFFFF, 0xF400F555, 0x04000400, 0xF4000400,
+  0xFFFFFFFF, 0xFF50FFD5, 0xFF40FF40, 0xFF40FF40, 0xFFFFFFFF, 0xFFD0FFD5, 0xFFC0FFD0, 0xFFC0FFC0,
+  0xFFFFFFFF, 0xFF50FFD5, 0xFF00FF40, 0xFF00FF00, 0xFFFFFFFF, 0xFD40FF55, 0xFC00FD00, 0xFC00FC00,
+  0xFFFFFFFF, 0xF500FD55, 0xF000F400, 0xF000F000, 0xFFFFFFFF, 0xF400F555, 0xC000F400, 0xC000C000,
+  0xFFFFFFFF, 0xF400F555, 0x0000F400, 0x00000000, 0xFFFFFFFF, 0xF400F555, 0x0400F400, 0x04000400,
+  0xFFFFFFFF, 0xFF40FF55, 0xFF40FF40, 0xFF40FF40, 0xFFFFFFFF, 0xFF40FF55, 0xFF40FF40, 0xFFC0FF40,
+  0xFFFFFFFF, 0xFF40FF55, 0xFF40FF40, 0xFF00FF00, 0xFFFFFFFF, 0xFD00FD55, 0xFD00FD00, 0xFC00FC00,
+  0xFFFFFFFF, 0xF400F555, 0xF400F400, 0xF000F000, 0xFFFFFFFF, 0xF400F555, 0xF400F400, 0xC000C000,
+  0xFFFFFFFF, 0xF400F555, 0xF400F400, 0x00000000, 0xFFFFFFFF, 0xF400F555, 0xF400F400, 0x04000400,
+  0xFFF0FFF0, 0xF400F555, 0xF400F400, 0xF400F400, 0xFFC0FFC0, 0xF400F555, 0xF400F400, 0xF400F400,
+  0xFF03FF03, 0xF400F555, 0xF400F400, 0xF400F400, 0xFC0FFC0F, 0xF400F555, 0xF400F400, 0xF400F400,
+  0xF03FF03F, 0xD000D555, 0xD000D000, 0xD000D000, 0xC0FFC0FF, 0xD000D555, 0xD000D000, 0xD000D000,
+  0x03FF03FF, 0xD000D555, 0xD000D000, 0xD000D000, 0x0FFF0FFF, 0xD000D555, 0xD000D000, 0xD000D000,
+  0xFFF0FFF0, 0xFD40FF50, 0xFD00FD00, 0xFD00FD00, 0xFFC0FFC0, 0xFD40FF40, 0xFD00FD00, 0xFD00FD00,
+  0xFF03FF03, 0xFD40FF01, 0xFD00FD00, 0xFD00FD00, 0xFC0FFC0F, 0xF400F405, 0xF400F400, 0xF400F400,
+  0xF03FF03F, 0xF400F015, 0xF400F400, 0xF400F400, 0xC0FFC0FF, 0xD000C055, 0xD000D000, 0xD000D000,
+  0x03FF03FF, 0xD0000155, 0xD000D000, 0xD000D000, 0x0FFF0FFF, 0xD0000555, 0xD000D000, 0xD000D000,
+  0xFFF0FFFF, 0xFFD0FFF0, 0xFF40FF40, 0xFF40FF40, 0xFFC0FFFF, 0xFFC0FFC0, 0xFF40FF40, 0xFF40FF40,
+  0xFF03FFFF, 0xFD01FF03, 0xFD00FD00, 0xFD00FD00, 0xFC0FFFFF, 0xFC01FC05, 0xFD00FD00, 0xFD00FD00,
+  0xF03FFFFF, 0xF000F015, 0xF400F400, 0xF400F400, 0xC0FFFFFF, 0xC000C055, 0xD000D000, 0xD000D000,
+  0x03FFFFFF, 0x00000155, 0xD000D000, 0xD000D000, 0x0FFFFFFF, 0x00000555, 0xD000D000, 0xD000D000,
+  0xFFFFFFFF, 0xFFF0FFF0, 0xFFD0FFC0, 0xFFD0FFD5, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xFFFFFFFF, 0xFF03FF03, 0xFF41FF00, 0xFF41FF55, 0xFFFFFFFF, 0xFC01FC05, 0xFD01FC00, 0xFD01FD51,
+  0xFFFFFFFF, 0xF000F015, 0xF400F000, 0xF400F540, 0xFFFFFFFF, 0xC000C055, 0xD000C000, 0xD000D500,
+  0xFFFFFFFF, 0x00000155, 0xD0000000, 0xD000D400, 0xFFFFFFFF, 0x00000555, 0xD0000000, 0xD000D000,
+  0xFFFFFFFF, 0xFFF0FFFF, 0xFFF0FFE0, 0xFFF5FFF6, 0xFFFFFFFF, 0xFFC0FFFF, 0xFFC0FFC0, 0xFFD5FFD9,
+  0xFFFFFFFF, 0xFF03FFFF, 0xFF03FF02, 0xFF57FF67, 0xFFFFFFFF, 0xFC01FFD5, 0xFC01FC00, 0xFD55FD91,
+  0xFFFFFFFF, 0xF000FF55, 0xF000F000, 0xF540F640, 0xFFFFFFFF, 0xC000FD55, 0xC000C000, 0xD500D900,
+  0xFFFFFFFF, 0x0000F555, 0x00000000, 0xF400F400, 0xFFFFFFFF, 0x0000D555, 0x00000000, 0xD000D000,
+  0xFFFFFFFF, 0xFFD1FFD5, 0xFFF0FFC0, 0xFFFFFFF0, 0xFFFFFFFF, 0xFFD1FFD5, 0xFFC0FFC0, 0xFFFFFFC0,
+  0xFFFFFFFF, 0xFFD1FFD5, 0xFF03FF00, 0xFFFFFF03, 0xFFFFFFFF, 0xFF41FF55, 0xFC01FC00, 0xFFD5FC01,
+  0xFFFFFFFF, 0xFD00FD55, 0xF000F000, 0xFF40F000, 0xFFFFFFFF, 0xF400F555, 0xC000C000, 0xFD00C000,
+  0xFFFFFFFF, 0xD000D555, 0x00000000, 0xF4000000, 0xFFFFFFFF, 0xD000D555, 0x00000000, 0xD0000000,
+  0xFFFFFFFF, 0xFF40FF55, 0xFFD0FF40, 0xFFF0FFF0, 0xFFFFFFFF, 0xFF40FF55, 0xFFC0FF40, 0xFFC0FFC0,
+  0xFFFFFFFF, 0xFF40FF55, 0xFF01FF40, 0xFF03FF03, 0xFFFFFFFF, 0xFD40FF55, 0xFC01FD00, 0xFC05FC01,
+  0xFFFFFFFF, 0xF500FD55, 0xF000F400, 0xF000F000, 0xFFFFFFFF, 0xD400F555, 0xC000D000, 0xC000C000,
+  0xFFFFFFFF, 0xD000D555, 0x0000D000, 0x00000000, 0xFFFFFFFF, 0xD000D555, 0x0000D000, 0x00000000,
+  0xFFFFFFFF, 0xFD00FD55, 0xFD40FD00, 0xFFF0FF50, 0xFFFFFFFF, 0xFD00FD55, 0xFD40FD00, 0xFFC0FF40,
+  0xFFFFFFFF, 0xFD00FD55, 0xFD40FD00, 0xFF03FF01, 0xFFFFFFFF, 0xFD00FD55, 0xFD00FD00, 0xFC01FC01,
+  0xFFFFFFFF, 0xF400F555, 0xF400F400, 0xF000F000, 0xFFFFFFFF, 0xD000D555, 0xD000D000, 0xC000C000,
+  0xFFFFFFFF, 0xD000D555, 0xD000D000, 0x00000000, 0xFFFFFFFF, 0xD000D555, 0xD000D000, 0x00000000,
+  0xFFF0FFF0, 0xD000D555, 0xD000D000, 0xD000D000, 0xFFC0FFC0, 0xD000D555, 0xD000D000, 0xD000D000,
+  0xFF03FF03, 0xD000D555, 0xD000D000, 0xD000D000, 0xFC0FFC0F, 0xD000D555, 0xD000D000, 0xD000D000,
+  0xF03FF03F, 0xD000D555, 0xD000D000, 0xD000D000, 0xC0FFC0FF, 0x40005555, 0x40004000, 0x40004000,
+  0x03FF03FF, 0x40005555, 0x40004000, 0x40004000, 0x0FFF0FFF, 0x40005555, 0x40004000, 0x40004000,
+  0xFFF0FFF0, 0xF500FD50, 0xF400F400, 0xF400F400, 0xFFC0FFC0, 0xF501FD40, 0xF400F400, 0xF400F400,
+  0xFF03FF03, 0xF501FD01, 0xF400F400, 0xF400F400, 0xFC0FFC0F, 0xF501FC05, 0xF400F400, 0xF400F400,
+  0xF03FF03F, 0xD001D015, 0xD000D000, 0xD000D000, 0xC0FFC0FF, 0xD001C055, 0xD000D000, 0xD000D000,
+  0x03FF03FF, 0x40000155, 0x40004000, 0x40004000, 0x0FFF0FFF, 0x40000555, 0x40004000, 0x40004000,
+  0xFFF0FFFF, 0xFF40FF50, 0xFD00FD00, 0xFD00FD00, 0xFFC0FFFF, 0xFF40FFC0, 0xFD00FD00, 0xFD00FD00,
+  0xFF03FFFF, 0xFF03FF03, 0xFD01FD01, 0xFD01FD01, 0xFC0FFFFF, 0xF407FC0F, 0xF401F401, 0xF401F401,
+  0xF03FFFFF, 0xF007F017, 0xF401F401, 0xF401F401, 0xC0FFFFFF, 0xC001C055, 0xD001D001, 0xD001D001,
+  0x03FFFFFF, 0x00000155, 0x40004000, 0x40004000, 0x0FFFFFFF, 0x00000555, 0x40004000, 0x40004000,
+  0xFFFFFFFF, 0xFF40FF50, 0xFF40FF00, 0xFF40FF45, 0xFFFFFFFF, 0xFFC0FFC0, 0xFF41FF00, 0xFF41FF55,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xFC0FFC0F, 0xFD07FC03, 0xFD07FD57,
+  0xFFFFFFFF, 0xF007F017, 0xF407F003, 0xF407F547, 0xFFFFFFFF, 0xC001C055, 0xD001C001, 0xD001D501,
+  0xFFFFFFFF, 0x00000155, 0x40000000, 0x40005400, 0xFFFFFFFF, 0x00000555, 0x40000000, 0x40005000,
+  0xFFFFFFFF, 0xFF40FF57, 0xFF40FF00, 0xFF55FF46, 0xFFFFFFFF, 0xFFC0FFFF, 0xFFC0FF80, 0xFFD5FFD9,
+  0xFFFFFFFF, 0xFF03FFFF, 0xFF03FF03, 0xFF57FF67, 0xFFFFFFFF, 0xFC0FFFFF, 0xFC0FFC0B, 0xFD5FFD9F,
+  0xFFFFFFFF, 0xF007FF57, 0xF007F003, 0xF557F647, 0xFFFFFFFF, 0xC001FD55, 0xC001C001, 0xD501D901,
+  0xFFFFFFFF, 0x0000F555, 0x00000000, 0x54006400, 0xFFFFFFFF, 0x0000D555, 0x00000000, 0xD000D000,
+  0xFFFFFFFF, 0xFF41FF55, 0xFF40FF00, 0xFF57FF40, 0xFFFFFFFF, 0xFF47FF57, 0xFFC0FF00, 0xFFFFFFC0,
+  0xFFFFFFFF, 0xFF47FF57, 0xFF03FF03, 0xFFFFFF03, 0xFFFFFFFF, 0xFF47FF57, 0xFC0FFC03, 0xFFFFFC0F,
+  0xFFFFFFFF, 0xFD07FD57, 0xF007F003, 0xFF57F007, 0xFFFFFFFF, 0xF401F555, 0xC001C001, 0xFD01C001,
+  0xFFFFFFFF, 0xD000D555, 0x00000000, 0xF4000000, 0xFFFFFFFF, 0x40005555, 0x00000000, 0xD0000000,
+  0xFFFFFFFF, 0xFD01FD55, 0xFF40FD00, 0xFF50FF40, 0xFFFFFFFF, 0xFD01FD55, 0xFF40FD01, 0xFFC0FFC0,
+  0xFFFFFFFF, 0xFD01FD55, 0xFF03FD01, 0xFF03FF03, 0xFFFFFFFF, 0xFD01FD55, 0xFC07FD01, 0xFC0FFC0F,
+  0xFFFFFFFF, 0xF501FD55, 0xF007F401, 0xF017F007, 0xFFFFFFFF, 0xD401F555, 0xC001D001, 0xC001C001,
+  0xFFFFFFFF, 0x5000D555, 0x00004000, 0x00000000, 0xFFFFFFFF, 0x40005555, 0x00004000, 0x00000000,
+  0xFFFFFFFF, 0xF400F555, 0xF500F400, 0xFF40FD40, 0xFFFFFFFF, 0xF400F555, 0xF501F400, 0xFFC0FD40,
+  0xFFFFFFFF, 0xF400F555, 0xF501F400, 0xFF03FD01, 0xFFFFFFFF, 0xF400F555, 0xF501F400, 0xFC0FFC05,
+  0xFFFFFFFF, 0xF400F555, 0xF401F400, 0xF007F005, 0xFFFFFFFF, 0xD000D555, 0xD001D000, 0xC001C001,
+  0xFFFFFFFF, 0x40005555, 0x40004000, 0x00000000, 0xFFFFFFFF, 0x40005555, 0x40004000, 0x00000000,
+  0xFFF0FFF0, 0x40005555, 0x40004000, 0x40004000, 0xFFC0FFC0, 0x40005555, 0x40004000, 0x40004000,
+  0xFF03FF03, 0x40005555, 0x40004000, 0x40004000, 0xFC0FFC0F, 0x40005555, 0x40004000, 0x40004000,
+  0xF03FF03F, 0x40005555, 0x40004000, 0x40004000, 0xC0FFC0FF, 0x40005555, 0x40004000, 0x40004000,
+  0x03FF03FF, 0x00005555, 0x00000000, 0x00000000, 0x0FFF0FFF, 0x00005555, 0x00000000, 0x00000000,
+  0xFFF0FFF0, 0xD400F550, 0xD000D000, 0xD000D000, 0xFFC0FFC0, 0xD400F540, 0xD000D000, 0xD000D000,
+  0xFF03FF03, 0xD405F503, 0xD001D001, 0xD001D001, 0xFC0FFC0F, 0xD405F407, 0xD001D001, 0xD001D001,
+  0xF03FF03F, 0xD405F017, 0xD001D001, 0xD001D001, 0xC0FFC0FF, 0x40054057, 0x40014001, 0x40014001,
+  0x03FF03FF, 0x40050157, 0x40014001, 0x40014001, 0x0FFF0FFF, 0x00010555, 0x00010001, 0x00010001,
+  0xFFF0FFFF, 0xF400F550, 0xF400F400, 0xF400F400, 0xFFC0FFFF, 0xFD00FD40, 0xF401F401, 0xF401F401,
+  0xFF03FFFF, 0xFD01FF03, 0xF401F401, 0xF401F401, 0xFC0FFFFF, 0xFC0FFC0F, 0xF407F407, 0xF407F407,
+  0xF03FFFFF, 0xD01FF03F, 0xD007D007, 0xD007D007, 0xC0FFFFFF, 0xC01FC05F, 0xD007D007, 0xD007D007,
+  0x03FFFFFF, 0x00070157, 0x40074007, 0x40074007, 0x0FFFFFFF, 0x00010555, 0x00010001, 0x00010001,
+  0xFFFFFFFF, 0xF400F550, 0xF400F400, 0xF400F405, 0xFFFFFFFF, 0xFD00FD40, 0xFD01FC00, 0xFD01FD15,
+  0xFFFFFFFF, 0xFF03FF03, 0xFD07FC03, 0xFD07FD57, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xFFFFFFFF, 0xF03FF03F, 0xF41FF00F, 0xF41FF55F, 0xFFFFFFFF, 0xC01FC05F, 0xD01FC00F, 0xD01FD51F,
+  0xFFFFFFFF, 0x00070157, 0x40070007, 0x40075407, 0xFFFFFFFF, 0x00010555, 0x00010001, 0x00015001,
+  0xFFFFFFFF, 0xF400F557, 0xF400F400, 0xF405F406, 0xFFFFFFFF, 0xFD00FD5F, 0xFD00FC00, 0xFD55FD19,
+  0xFFFFFFFF, 0xFF03FFFF, 0xFF03FE03, 0xFF57FF67, 0xFFFFFFFF, 0xFC0FFFFF, 0xFC0FFC0F, 0xFD5FFD9F,
+  0xFFFFFFFF, 0xF03FFFFF, 0xF03FF02F, 0xF57FF67F, 0xFFFFFFFF, 0xC01FFD5F, 0xC01FC00F, 0xD55FD91F,
+  0xFFFFFFFF, 0x0007F557, 0x00070007, 0x54076407, 0xFFFFFFFF, 0x0001D555, 0x00010001, 0x50019001,
+  0xFFFFFFFF, 0xF401F555, 0xF400F400, 0xF407F400, 0xFFFFFFFF, 0xFD07FD57, 0xFD00FC00, 0xFD5FFD00,
+  0xFFFFFFFF, 0xFD1FFD5F, 0xFF03FC03, 0xFFFFFF03, 0xFFFFFFFF, 0xFD1FFD5F, 0xFC0FFC0F, 0xFFFFFC0F,
+  0xFFFFFFFF, 0xFD1FFD5F, 0xF03FF00F, 0xFFFFF03F, 0xFFFFFFFF, 0xF41FF55F, 0xC01FC00F, 0xFD5FC01F,
+  0xFFFFFFFF, 0xD007D557, 0x00070007, 0xF4070007, 0xFFFFFFFF, 0x40015555, 0x00010001, 0xD0010001,
+  0xFFFFFFFF, 0xF401F555, 0xF400F400, 0xF400F400, 0xFFFFFFFF, 0xF405F557, 0xFD00F401, 0xFD40FD00,
+  0xFFFFFFFF, 0xF407F557, 0xFD03F407, 0xFF03FF03, 0xFFFFFFFF, 0xF407F557, 0xFC0FF407, 0xFC0FFC0F,
+  0xFFFFFFFF, 0xF407F557, 0xF01FF407, 0xF03FF03F, 0xFFFFFFFF, 0xD407F557, 0xC01FD007, 0xC05FC01F,
+  0xFFFFFFFF, 0x5007D557, 0x00074007, 0x00070007, 0xFFFFFFFF, 0x40015555, 0x00010001, 0x00010001,
+  0xFFFFFFFF, 0xD000D555, 0xD400D000, 0xF400F400, 0xFFFFFFFF, 0xD001D555, 0xD401D001, 0xFD00F500,
+  0xFFFFFFFF, 0xD001D555, 0xD405D001, 0xFF03F503, 0xFFFFFFFF, 0xD001D555, 0xD405D001, 0xFC0FF407,
+  0xFFFFFFFF, 0xD001D555, 0xD405D001, 0xF03FF017, 0xFFFFFFFF, 0xD001D555, 0xD005D001, 0xC01FC017,
+  0xFFFFFFFF, 0x40015555, 0x40054001, 0x00070007, 0xFFFFFFFF, 0x00015555, 0x00010001, 0x00010001,
+  0xFFF0FFF0, 0xFD55FFFF, 0xFD00FD00, 0xFD00FD00, 0xFFC0FFC0, 0xFD55FFFF, 0xFD00FD00, 0xFD00FD00,
+  0xFF03FF03, 0xFD55FFFF, 0xFD00FD00, 0xFD00FD00, 0xFC0FFC0F, 0xFD55FFFF, 0xFD00FD00, 0xFD00FD00,
+  0xF03FF03F, 0xFD55FFFF, 0xFD00FD00, 0xFD00FD00, 0xC0FFC0FF, 0xFD55FFFF, 0xFD00FD00, 0xFD00FD00,
+  0x03FF03FF, 0xFD55FFFF, 0xFD00FD00, 0xFD00FD00, 0x0FFF0FFF, 0xFD55FFFF, 0xFD00FD00, 0xFD00FD00,
+  0xFFF0FFF0, 0xFD55FFF0, 0xFD00FD00, 0xFD00FD00, 0xFFC0FFC0, 0xFD55FFC0, 0xFD00FD00, 0xFD00FD00,
+  0xFF03FF03, 0xFD55FF03, 0xFD00FD00, 0xFD00FD00, 0xFC0FFC0F, 0xFD55FC0F, 0xFD00FD00, 0xFD00FD00,
+  0xF03FF03F, 0xFD55F03F, 0xFD00FD00, 0xFD00FD00, 0xC0FFC0FF, 0xFD55C0FF, 0xFD00FD00, 0xFD00FD00,
+  0x03FF03FF, 0xFD5503FF, 0xFD00FD00, 0xFD00FD00, 0x0FFF0FFF, 0xFD550FFF, 0xFD00FD00, 0xFD00FD00,
+  0xFFF0FFFF, 0xFD50FFF0, 0xFD00FD00, 0xFD00FD00, 0xFFC0FFFF, 0xFD40FFC0, 0xFD00FD00, 0xFD00FD00,
+  0xFF03FFFF, 0xFD01FF03, 0xFD00FD00, 0xFD00FD00, 0xFC0FFFFF, 0xFC05FC0F, 0xFD00FD00, 0xFD00FD00,
+  0xF03FFFFF, 0xF015F03F, 0xFD00FD00, 0xFD00FD00, 0xC0FFFFFF, 0xC055C0FF, 0xFD00FD00, 0xFD00FD00,
+  0x03FFFFFF, 0x015503FF, 0xFD00FD00, 0xFD00FD00, 0x0FFFFFFF, 0x0D550FFF, 0xFD00FD00, 0xFD00FD00,
+  0xFFFFFFFF, 0xFF50FFF0, 0xFD00FD40, 0xFD00FD00, 0xFFFFFFFF, 0xFFC0FFC0, 0xFD00FD40, 0xFD00FD00,
+  0xFFFFFFFF, 0xFF01FF03, 0xFD00FD00, 0xFD00FD00, 0xFFFFFFFF, 0xFC05FC0F, 0xFD00FC00, 0xFD00FD00,
+  0xFFFFFFFF, 0xF015F03F, 0xFD00F000, 0xFD00FD00, 0xFFFFFFFF, 0xC055C0FF, 0xFD00C000, 0xFD00FD00,
+  0xFFFFFFFF, 0x015503FF, 0xFD000100, 0xFD00FD00, 0xFFFFFFFF, 0x0D550FFF, 0xFD000D00, 0xFD00FD00,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xFFC0FFFF, 0xFD40FFC0, 0xFD00FD00,
+  0xFFFFFFFF, 0xFF01FFFF, 0xFD00FF00, 0xFD00FD00, 0xFFFFFFFF, 0xFC05FFFF, 0xFC00FC00, 0xFD00FD00,
+  0xFFFFFFFF, 0xF015FFFF, 0xF000F000, 0xFD00FD00, 0xFFFFFFFF, 0xC055FFFF, 0xC000C000, 0xFD00FD00,
+  0xFFFFFFFF, 0x0155FFFF, 0x01000100, 0xFD00FD00, 0xFFFFFFFF, 0x0D55FFFF, 0x0D000D00, 0xFD00FD00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF40FF50, 0xFF40FF40, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFC0FFC0, 0xFF40FF40,
+  0xFFFFFFFF, 0xFFF5FFFF, 0xFF00FF00, 0xFF40FF00, 0xFFFFFFFF, 0xFFD5FFFF, 0xFC00FC00, 0xFD00FC00,
+  0xFFFFFFFF, 0xFF55FFFF, 0xF000F000, 0xFD00F000, 0xFFFFFFFF, 0xFD55FFFF, 0xC000C000, 0xFD00C000,
+  0xFFFFFFFF, 0xFD55FFFF, 0x01000100, 0xFD000100, 0xFFFFFFFF, 0xFD55FFFF, 0x0D000D00, 0xFD000D00,
+  0xFFFFFFFF, 0xFFF5FFFF, 0xFF40FF54, 0xFF40FF40, 0xFFFFFFFF, 0xFFF5FFFF, 0xFFC0FFF4, 0xFFC0FFC0,
+  0xFFFFFFFF, 0xFFD5FFFF, 0xFF00FFD0, 0xFF00FF00, 0xFFFFFFFF, 0xFF55FFFF, 0xFC00FF40, 0xFC00FC00,
+  0xFFFFFFFF, 0xFD55FFFF, 0xF000FD00, 0xF000F000, 0xFFFFFFFF, 0xFD55FFFF, 0xC000FD00, 0xC000C000,
+  0xFFFFFFFF, 0xFD55FFFF, 0x0100FD00, 0x01000100, 0xFFFFFFFF, 0xFD55FFFF, 0x0D00FD00, 0x0D000D00,
+  0xFFFFFFFF, 0xFFD5FFFF, 0xFF40FF50, 0xFF40FF40, 0xFFFFFFFF, 0xFFD5FFFF, 0xFFD0FFD0, 0xFFC0FFC0,
+  0xFFFFFFFF, 0xFFD5FFFF, 0xFF40FF50, 0xFF00FF00, 0xFFFFFFFF, 0xFF55FFFF, 0xFD00FD40, 0xFC00FC00,
+  0xFFFFFFFF, 0xFD55FFFF, 0xFD00FD00, 0xF000F000, 0xFFFFFFFF, 0xFD55FFFF, 0xFD00FD00, 0xC000C000,
+  0xFFFFFFFF, 0xFD55FFFF, 0xFD00FD00, 0x01000100, 0xFFFFFFFF, 0xFD55FFFF, 0xFD00FD00, 0x0D000D00,
+  0xFFF0FFF0, 0xF555FFFF, 0xF400F400, 0xF400F400, 0xFFC0FFC0, 0xF555FFFF, 0xF400F400, 0xF400F400,
+  0xFF03FF03, 0xF555FFFF, 0xF400F400, 0xF400F400, 0xFC0FFC0F, 0xF555FFFF, 0xF400F400, 0xF400F400,
+  0xF03FF03F, 0xF555FFFF, 0xF400F400, 0xF400F400, 0xC0FFC0FF, 0xF555FFFF, 0xF400F400, 0xF400F400,
+  0x03FF03FF, 0xF555FFFF, 0xF400F400, 0xF400F400, 0x0FFF0FFF, 0xF555FFFF, 0xF400F400, 0xF400F400,
+  0xFFF0FFF0, 0xF555FFF0, 0xF400F400, 0xF400F400, 0xFFC0FFC0, 0xF555FFC0, 0xF400F400, 0xF400F400,
+  0xFF03FF03, 0xF555FF03, 0xF400F400, 0xF400F400, 0xFC0FFC0F, 0xF555FC0F, 0xF400F400, 0xF400F400,
+  0xF03FF03F, 0xF555F03F, 0xF400F400, 0xF400F400, 0xC0FFC0FF, 0xF555C0FF, 0xF400F400, 0xF400F400,
+  0x03FF03FF, 0xF55503FF, 0xF400F400, 0xF400F400, 0x0FFF0FFF, 0xF5550FFF, 0xF400F400, 0xF400F400,
+  0xFFF0FFFF, 0xFF50FFF0, 0xFD00FD40, 0xFD00FD00, 0xFFC0FFFF, 0xFF40FFC0, 0xFD00FD40, 0xFD00FD00,
+  0xFF03FFFF, 0xFF01FF03, 0xFD00FD40, 0xFD00FD00, 0xFC0FFFFF, 0xF405FC0F, 0xF400F400, 0xF400F400,
+  0xF03FFFFF, 0xF015F03F, 0xF400F400, 0xF400F400, 0xC0FFFFFF, 0xC055C0FF, 0xF400F400, 0xF400F400,
+  0x03FFFFFF, 0x015503FF, 0xF400F400, 0xF400F400, 0x0FFFFFFF, 0x05550FFF, 0xF400F400, 0xF400F400,
+  0xFFFFFFFF, 0xFFF0FFF0, 0xFF40FFD0, 0xFF40FF40, 0xFFFFFFFF, 0xFFC0FFC0, 0xFF40FFC0, 0xFF40FF40,
+  0xFFFFFFFF, 0xFF03FF03, 0xFD00FD01, 0xFD00FD00, 0xFFFFFFFF, 0xFC05FC0F, 0xFD00FC01, 0xFD00FD00,
+  0xFFFFFFFF, 0xF015F03F, 0xF400F000, 0xFD00F500, 0xFFFFFFFF, 0xC055C0FF, 0xF400C000, 0xF400F400,
+  0xFFFFFFFF, 0x015503FF, 0xF4000000, 0xF400F400, 0xFFFFFFFF, 0x05550FFF, 0xF4000400, 0xF400F400,
+  0xFFFFFFFF, 0xFFF0FFFF, 0xFFC0FFF0, 0xFFD5FFD0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xFFFFFFFF, 0xFF03FFFF, 0xFF00FF03, 0xFF55FF41, 0xFFFFFFFF, 0xFC05FFFF, 0xFC00FC01, 0xFF55FF41,
+  0xFFFFFFFF, 0xF015FFFF, 0xF000F000, 0xFD40FD00, 0xFFFFFFFF, 0xC055FFFF, 0xC000C000, 0xF500F400,
+  0xFFFFFFFF, 0x0155FFFF, 0x00000000, 0xF400F400, 0xFFFFFFFF, 0x0555FFFF, 0x04000400, 0xF400F400,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFE0FFF0, 0xFFFFFFF0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFC0FFC0, 0xFFFFFFC0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF02FF03, 0xFFFFFF03, 0xFFFFFFFF, 0xFFD5FFFF, 0xFC00FC01, 0xFFD5FC01,
+  0xFFFFFFFF, 0xFF55FFFF, 0xF000F000, 0xFF40F000, 0xFFFFFFFF, 0xFD55FFFF, 0xC000C000, 0xFD00C000,
+  0xFFFFFFFF, 0xF555FFFF, 0x00000000, 0xF4000000, 0xFFFFFFFF, 0xF555FFFF, 0x04000400, 0xF4000400,
+  0xFFFFFFFF, 0xFFD5FFFF, 0xFFC0FFD1, 0xFFF0FFF0, 0xFFFFFFFF, 0xFFD5FFFF, 0xFFC0FFD1, 0xFFC0FFC0,
+  0xFFFFFFFF, 0xFFD5FFFF, 0xFF00FFD1, 0xFF03FF03, 0xFFFFFFFF, 0xFF55FFFF, 0xFC00FF41, 0xFC05FC01,
+  0xFFFFFFFF, 0xFD55FFFF, 0xF000FD00, 0xF000F000, 0xFFFFFFFF, 0xF555FFFF, 0xC000F400, 0xC000C000,
+  0xFFFFFFFF, 0xF555FFFF, 0x0000F400, 0x00000000, 0xFFFFFFFF, 0xF555FFFF, 0x0400F400, 0x04000400,
+  0xFFFFFFFF, 0xFF55FFFF, 0xFF40FF40, 0xFFF0FFD0, 0xFFFFFFFF, 0xFF55FFFF, 0xFF40FF40, 0xFFC0FFC0,
+  0xFFFFFFFF, 0xFF55FFFF, 0xFF40FF40, 0xFF03FF01, 0xFFFFFFFF, 0xFF55FFFF, 0xFD00FD40, 0xFC01FC01,
+  0xFFFFFFFF, 0xFD55FFFF, 0xF400F500, 0xF000F000, 0xFFFFFFFF, 0xF555FFFF, 0xF400F400, 0xC000C000,
+  0xFFFFFFFF, 0xF555FFFF, 0xF400F400, 0x00000000, 0xFFFFFFFF, 0xF555FFFF, 0xF400F400, 0x04000400,
+  0xFFF0FFF0, 0xD555FFFF, 0xD000D000, 0xD000D000, 0xFFC0FFC0, 0xD555FFFF, 0xD000D000, 0xD000D000,
+  0xFF03FF03, 0xD555FFFF, 0xD000D000, 0xD000D000, 0xFC0FFC0F, 0xD555FFFF, 0xD000D000, 0xD000D000,
+  0xF03FF03F, 0xD555FFFF, 0xD000D000, 0xD000D000, 0xC0FFC0FF, 0xD555FFFF, 0xD000D000, 0xD000D000,
+  0x03FF03FF, 0xD555FFFF, 0xD000D000, 0xD000D000, 0x0FFF0FFF, 0xD555FFFF, 0xD000D000, 0xD000D000,
+  0xFFF0FFF0, 0xD555FFF0, 0xD000D000, 0xD000D000, 0xFFC0FFC0, 0xD555FFC0, 0xD000D000, 0xD000D000,
+  0xFF03FF03, 0xD555FF03, 0xD000D000, 0xD000D000, 0xFC0FFC0F, 0xD555FC0F, 0xD000D000, 0xD000D000,
+  0xF03FF03F, 0xD555F03F, 0xD000D000, 0xD000D000, 0xC0FFC0FF, 0xD555C0FF, 0xD000D000, 0xD000D000,
+  0x03FF03FF, 0xD55503FF, 0xD000D000, 0xD000D000, 0x0FFF0FFF, 0xD5550FFF, 0xD000D000, 0xD000D000,
+  0xFFF0FFFF, 0xFD50FFF0, 0xF400F500, 0xF400F400, 0xFFC0FFFF, 0xFD40FFC0, 0xF400F501, 0xF400F400,
+  0xFF03FFFF, 0xFD01FF03, 0xF400F501, 0xF400F400, 0xFC0FFFFF, 0xFC05FC0F, 0xF400F501, 0xF400F400,
+  0xF03FFFFF, 0xD015F03F, 0xD000D001, 0xD000D000, 0xC0FFFFFF, 0xC055C0FF, 0xD000D001, 0xD000D000,
+  0x03FFFFFF, 0x015503FF, 0xD000D000, 0xD000D000, 0x0FFFFFFF, 0x05550FFF, 0xD000D000, 0xD000D000,
+  0xFFFFFFFF, 0xFF50FFF0, 0xFD00FF40, 0xFD00FD00, 0xFFFFFFFF, 0xFFC0FFC0, 0xFD00FF40, 0xFD00FD00,
+  0xFFFFFFFF, 0xFF03FF03, 0xFD01FF03, 0xFD01FD01, 0xFFFFFFFF, 0xFC0FFC0F, 0xF401F407, 0xF401F401,
+  0xFFFFFFFF, 0xF017F03F, 0xF401F007, 0xF401F401, 0xFFFFFFFF, 0xC055C0FF, 0xD001C001, 0xF401D401,
+  0xFFFFFFFF, 0x015503FF, 0xD0000000, 0xD000D000, 0xFFFFFFFF, 0x05550FFF, 0xD0000000, 0xD000D000,
+  0xFFFFFFFF, 0xFF50FFFF, 0xFF00FF40, 0xFF55FF41, 0xFFFFFFFF, 0xFFC0FFFF, 0xFF00FFC0, 0xFF55FF41,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xFC0FFFFF, 0xFC03FC0F, 0xFD57FD07,
+  0xFFFFFFFF, 0xF017FFFF, 0xF003F007, 0xFD57FD07, 0xFFFFFFFF, 0xC055FFFF, 0xC001C001, 0xF501F401,
+  0xFFFFFFFF, 0x0155FFFF, 0x00000000, 0xD400D000, 0xFFFFFFFF, 0x0555FFFF, 0x00000000, 0xD000D000,
+  0xFFFFFFFF, 0xFF57FFFF, 0xFF00FF40, 0xFF57FF40, 0xFFFFFFFF, 0xFFFFFFFF, 0xFF80FFC0, 0xFFFFFFC0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF03FF03, 0xFFFFFF03, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC0BFC0F, 0xFFFFFC0F,
+  0xFFFFFFFF, 0xFF57FFFF, 0xF003F007, 0xFF57F007, 0xFFFFFFFF, 0xFD55FFFF, 0xC001C001, 0xFD01C001,
+  0xFFFFFFFF, 0xF555FFFF, 0x00000000, 0xF4000000, 0xFFFFFFFF, 0xD555FFFF, 0x00000000, 0xD0000000,
+  0xFFFFFFFF, 0xFF55FFFF, 0xFF00FF41, 0xFF50FF40, 0xFFFFFFFF, 0xFF57FFFF, 0xFF00FF47, 0xFFC0FFC0,
+  0xFFFFFFFF, 0xFF57FFFF, 0xFF03FF47, 0xFF03FF03, 0xFFFFFFFF, 0xFF57FFFF, 0xFC03FF47, 0xFC0FFC0F,
+  0xFFFFFFFF, 0xFD57FFFF, 0xF003FD07, 0xF017F007, 0xFFFFFFFF, 0xF555FFFF, 0xC001F401, 0xC001C001,
+  0xFFFFFFFF, 0xD555FFFF, 0x0000D000, 0x00000000, 0xFFFFFFFF, 0xD555FFFF, 0x0000D000, 0x00000000,
+  0xFFFFFFFF, 0xFD55FFFF, 0xFD00FD01, 0xFF40FF40, 0xFFFFFFFF, 0xFD55FFFF, 0xFD01FD01, 0xFFC0FF40,
+  0xFFFFFFFF, 0xFD55FFFF, 0xFD01FD01, 0xFF03FF03, 0xFFFFFFFF, 0xFD55FFFF, 0xFD01FD01, 0xFC0FFC07,
+  0xFFFFFFFF, 0xFD55FFFF, 0xF401F501, 0xF007F007, 0xFFFFFFFF, 0xF555FFFF, 0xD001D401, 0xC001C001,
+  0xFFFFFFFF, 0xD555FFFF, 0xD000D000, 0x00000000, 0xFFFFFFFF, 0xD555FFFF, 0xD000D000, 0x00000000,
+  0xFFF0FFF0, 0x5555FFFF, 0x40004000, 0x40004000, 0xFFC0FFC0, 0x5555FFFF, 0x40004000, 0x40004000,
+  0xFF03FF03, 0x5555FFFF, 0x40004000, 0x40004000, 0xFC0FFC0F, 0x5555FFFF, 0x40004000, 0x40004000,
+  0xF03FF03F, 0x5555FFFF, 0x40004000, 0x40004000, 0xC0FFC0FF, 0x5555FFFF, 0x40004000, 0x40004000,
+  0x03FF03FF, 0x5555FFFF, 0x40004000, 0x40004000, 0x0FFF0FFF, 0x5555FFFF, 0x40004000, 0x40004000,
+  0xFFF0FFF0, 0x5555FFF0, 0x40004000, 0x40004000, 0xFFC0FFC0, 0x5555FFC0, 0x40004000, 0x40004000,
+  0xFF03FF03, 0x5555FF03, 0x40004000, 0x40004000, 0xFC0FFC0F, 0x5555FC0F, 0x40004000, 0x40004000,
+  0xF03FF03F, 0x5555F03F, 0x40004000, 0x40004000, 0xC0FFC0FF, 0x5555C0FF, 0x40004000, 0x40004000,
+  0x03FF03FF, 0x555503FF, 0x40004000, 0x40004000, 0x0FFF0FFF, 0x55550FFF, 0x40004000, 0x40004000,
+  0xFFF0FFFF, 0xF550FFF0, 0xD000D400, 0xD000D000, 0xFFC0FFFF, 0xF540FFC0, 0xD000D400, 0xD000D000,
+  0xFF03FFFF, 0xF503FF03, 0xD001D405, 0xD001D001, 0xFC0FFFFF, 0xF407FC0F, 0xD001D405, 0xD001D001,
+  0xF03FFFFF, 0xF017F03F, 0xD001D405, 0xD001D001, 0xC0FFFFFF, 0x4057C0FF, 0x40014005, 0x40014001,
+  0x03FFFFFF, 0x015703FF, 0x40014005, 0x40014001, 0x0FFFFFFF, 0x05550FFF, 0x40014001, 0x40014001,
+  0xFFFFFFFF, 0xF550FFF0, 0xF400F400, 0xF401F401, 0xFFFFFFFF, 0xFD40FFC0, 0xF401FD00, 0xF401F401,
+  0xFFFFFFFF, 0xFF03FF03, 0xF401FD01, 0xF401F401, 0xFFFFFFFF, 0xFC0FFC0F, 0xF407FC0F, 0xF407F407,
+  0xFFFFFFFF, 0xF03FF03F, 0xD007D01F, 0xD007D007, 0xFFFFFFFF, 0xC05FC0FF, 0xD007C01F, 0xD007D007,
+  0xFFFFFFFF, 0x015703FF, 0x40070007, 0xD0075007, 0xFFFFFFFF, 0x05550FFF, 0x40010001, 0x40014001,
+  0xFFFFFFFF, 0xF550FFFF, 0xF400F400, 0xF405F401, 0xFFFFFFFF, 0xFD40FFFF, 0xFC00FD00, 0xFD57FD07,
+  0xFFFFFFFF, 0xFF03FFFF, 0xFC03FF03, 0xFD57FD07, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xFFFFFFFF, 0xF03FFFFF, 0xF00FF03F, 0xF55FF41F, 0xFFFFFFFF, 0xC05FFFFF, 0xC00FC01F, 0xF55FF41F,
+  0xFFFFFFFF, 0x0157FFFF, 0x00070007, 0xD407D007, 0xFFFFFFFF, 0x0555FFFF, 0x00010001, 0x50014001,
+  0xFFFFFFFF, 0xF557FFFF, 0xF400F400, 0xF407F400, 0xFFFFFFFF, 0xFD5FFFFF, 0xFC00FD00, 0xFD5FFD00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFE03FF03, 0xFFFFFF03, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC0FFC0F, 0xFFFFFC0F,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF02FF03F, 0xFFFFF03F, 0xFFFFFFFF, 0xFD5FFFFF, 0xC00FC01F, 0xFD5FC01F,
+  0xFFFFFFFF, 0xF557FFFF, 0x00070007, 0xF4070007, 0xFFFFFFFF, 0xD555FFFF, 0x00010001, 0xD0010001,
+  0xFFFFFFFF, 0xF555FFFF, 0xF400F401, 0xF400F400, 0xFFFFFFFF, 0xFD57FFFF, 0xFC00FD07, 0xFD40FD00,
+  0xFFFFFFFF, 0xFD5FFFFF, 0xFC03FD1F, 0xFF03FF03, 0xFFFFFFFF, 0xFD5FFFFF, 0xFC0FFD1F, 0xFC0FFC0F,
+  0xFFFFFFFF, 0xFD5FFFFF, 0xF00FFD1F, 0xF03FF03F, 0xFFFFFFFF, 0xF55FFFFF, 0xC00FF41F, 0xC05FC01F,
+  0xFFFFFFFF, 0xD557FFFF, 0x0007D007, 0x00070007, 0xFFFFFFFF, 0x5555FFFF, 0x00014001, 0x00010001,
+  0xFFFFFFFF, 0xF555FFFF, 0xF400F401, 0xF400F400, 0xFFFFFFFF, 0xF557FFFF, 0xF401F405, 0xFD00FD00,
+  0xFFFFFFFF, 0xF557FFFF, 0xF407F407, 0xFF03FD03, 0xFFFFFFFF, 0xF557FFFF, 0xF407F407, 0xFC0FFC0F,
+  0xFFFFFFFF, 0xF557FFFF, 0xF407F407, 0xF03FF01F, 0xFFFFFFFF, 0xF557FFFF, 0xD007D407, 0xC01FC01F,
+  0xFFFFFFFF, 0xD557FFFF, 0x40075007, 0x00070007, 0xFFFFFFFF, 0x5555FFFF, 0x40014001, 0x00010001,
+  0xFFF0FFF0, 0xFFFFFFFF, 0xFF40FF55, 0xFF40FF40, 0xFFC0FFC0, 0xFFFFFFFF, 0xFF40FF55, 0xFF40FF40,
+  0xFF03FF03, 0xFFFFFFFF, 0xFF40FF55, 0xFF40FF40, 0xFC0FFC0F, 0xFFFFFFFF, 0xFF40FF55, 0xFF40FF40,
+  0xF03FF03F, 0xFFFFFFFF, 0xFF40FF55, 0xFF40FF40, 0xC0FFC0FF, 0xFFFFFFFF, 0xFF40FF55, 0xFF40FF40,
+  0x03FF03FF, 0xFFFFFFFF, 0xFF40FF55, 0xFF40FF40, 0x0FFF0FFF, 0xFFFFFFFF, 0xFF40FF55, 0xFF40FF40,
+  0xFFF0FFF0, 0xFFFFFFF0, 0xFF40FF55, 0xFF40FF40, 0xFFC0FFC0, 0xFFFFFFC0, 0xFF40FF55, 0xFF40FF40,
+  0xFF03FF03, 0xFFFFFF03, 0xFF40FF55, 0xFF40FF40, 0xFC0FFC0F, 0xFFFFFC0F, 0xFF40FF55, 0xFF40FF40,
+  0xF03FF03F, 0xFFFFF03F, 0xFF40FF55, 0xFF40FF40, 0xC0FFC0FF, 0xFFFFC0FF, 0xFF40FF55, 0xFF40FF40,
+  0x03FF03FF, 0xFFFF03FF, 0xFF40FF55, 0xFF40FF40, 0x0FFF0FFF, 0xFFFF0FFF, 0xFF40FF55, 0xFF40FF40,
+  0xFFF0FFFF, 0xFFF0FFF0, 0xFF40FF55, 0xFF40FF40, 0xFFC0FFFF, 0xFFC0FFC0, 0xFF40FF55, 0xFF40FF40,
+  0xFF03FFFF, 0xFF03FF03, 0xFF40FF55, 0xFF40FF40, 0xFC0FFFFF, 0xFC0FFC0F, 0xFF40FF55, 0xFF40FF40,
+  0xF03FFFFF, 0xF03FF03F, 0xFF40FF55, 0xFF40FF40, 0xC0FFFFFF, 0xC0FFC0FF, 0xFF40FF55, 0xFF40FF40,
+  0x03FFFFFF, 0x03FF03FF, 0xFF40FF55, 0xFF40FF40, 0x0FFFFFFF, 0x0FFF0FFF, 0xFF40FF55, 0xFF40FF40,
+  0xFFFFFFFF, 0xFFF0FFF0, 0xFF40FF50, 0xFF40FF40, 0xFFFFFFFF, 0xFFC0FFC0, 0xFF40FF40, 0xFF40FF40,
+  0xFFFFFFFF, 0xFF03FF03, 0xFF40FF01, 0xFF40FF40, 0xFFFFFFFF, 0xFC0FFC0F, 0xFF40FC05, 0xFF40FF40,
+  0xFFFFFFFF, 0xF03FF03F, 0xFF40F015, 0xFF40FF40, 0xFFFFFFFF, 0xC0FFC0FF, 0xFF40C055, 0xFF40FF40,
+  0xFFFFFFFF, 0x03FF03FF, 0xFF400355, 0xFF40FF40, 0xFFFFFFFF, 0x0FFF0FFF, 0xFF400F55, 0xFF40FF40,
+  0xFFFFFFFF, 0xFFF0FFFF, 0xFF40FF50, 0xFF40FF40, 0xFFFFFFFF, 0xFFC0FFFF, 0xFF40FFC0, 0xFF40FF40,
+  0xFFFFFFFF, 0xFF03FFFF, 0xFF00FF01, 0xFF40FF40, 0xFFFFFFFF, 0xFC0FFFFF, 0xFC00FC05, 0xFF40FF40,
+  0xFFFFFFFF, 0xF03FFFFF, 0xF000F015, 0xFF40FF40, 0xFFFFFFFF, 0xC0FFFFFF, 0xC040C055, 0xFF40FF40,
+  0xFFFFFFFF, 0x03FFFFFF, 0x03400355, 0xFF40FF40, 0xFFFFFFFF, 0x0FFFFFFF, 0x0F400F55, 0xFF40FF40,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFC0FFC0, 0xFFD0FFC0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF00FF01, 0xFFD0FF00, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC00FC05, 0xFF40FC00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF000F015, 0xFF40F000, 0xFFFFFFFF, 0xFFFFFFFF, 0xC040C055, 0xFF40C040,
+  0xFFFFFFFF, 0xFFFFFFFF, 0x03400355, 0xFF400340, 0xFFFFFFFF, 0xFFFFFFFF, 0x0F400F55, 0xFF400F40,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF50FFFF, 0xFF40FF40, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFC0FFFF, 0xFFC0FFC0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF00FFF5, 0xFF00FF00, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC00FFD5, 0xFC00FC00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF000FF55, 0xF000F000, 0xFFFFFFFF, 0xFFFFFFFF, 0xC040FF55, 0xC040C040,
+  0xFFFFFFFF, 0xFFFFFFFF, 0x0340FF55, 0x03400340, 0xFFFFFFFF, 0xFFFFFFFF, 0x0F40FF55, 0x0F400F40,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF50FFD5, 0xFF40FF40, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFF4FFF5, 0xFFC0FFC0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFD0FFD5, 0xFF00FF00, 0xFFFFFFFF, 0xFFFFFFFF, 0xFF40FF55, 0xFC00FC00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF40FF55, 0xF000F000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFF40FF55, 0xC040C040,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF40FF55, 0x03400340, 0xFFFFFFFF, 0xFFFFFFFF, 0xFF40FF55, 0x0F400F40,
+  0xFFF0FFF0, 0xFFFFFFFF, 0xFD00FD55, 0xFD00FD00, 0xFFC0FFC0, 0xFFFFFFFF, 0xFD00FD55, 0xFD00FD00,
+  0xFF03FF03, 0xFFFFFFFF, 0xFD00FD55, 0xFD00FD00, 0xFC0FFC0F, 0xFFFFFFFF, 0xFD00FD55, 0xFD00FD00,
+  0xF03FF03F, 0xFFFFFFFF, 0xFD00FD55, 0xFD00FD00, 0xC0FFC0FF, 0xFFFFFFFF, 0xFD00FD55, 0xFD00FD00,
+  0x03FF03FF, 0xFFFFFFFF, 0xFD00FD55, 0xFD00FD00, 0x0FFF0FFF, 0xFFFFFFFF, 0xFD00FD55, 0xFD00FD00,
+  0xFFF0FFF0, 0xFFFFFFF0, 0xFD00FD55, 0xFD00FD00, 0xFFC0FFC0, 0xFFFFFFC0, 0xFD00FD55, 0xFD00FD00,
+  0xFF03FF03, 0xFFFFFF03, 0xFD00FD55, 0xFD00FD00, 0xFC0FFC0F, 0xFFFFFC0F, 0xFD00FD55, 0xFD00FD00,
+  0xF03FF03F, 0xFFFFF03F, 0xFD00FD55, 0xFD00FD00, 0xC0FFC0FF, 0xFFFFC0FF, 0xFD00FD55, 0xFD00FD00,
+  0x03FF03FF, 0xFFFF03FF, 0xFD00FD55, 0xFD00FD00, 0x0FFF0FFF, 0xFFFF0FFF, 0xFD00FD55, 0xFD00FD00,
+  0xFFF0FFFF, 0xFFF0FFF0, 0xFD00FD55, 0xFD00FD00, 0xFFC0FFFF, 0xFFC0FFC0, 0xFD00FD55, 0xFD00FD00,
+  0xFF03FFFF, 0xFF03FF03, 0xFD00FD55, 0xFD00FD00, 0xFC0FFFFF, 0xFC0FFC0F, 0xFD00FD55, 0xFD00FD00,
+  0xF03FFFFF, 0xF03FF03F, 0xFD00FD55, 0xFD00FD00, 0xC0FFFFFF, 0xC0FFC0FF, 0xFD00FD55, 0xFD00FD00,
+  0x03FFFFFF, 0x03FF03FF, 0xFD00FD55, 0xFD00FD00, 0x0FFFFFFF, 0x0FFF0FFF, 0xFD00FD55, 0xFD00FD00,
+  0xFFFFFFFF, 0xFFF0FFF0, 0xFF40FF50, 0xFF40FF40, 0xFFFFFFFF, 0xFFC0FFC0, 0xFF40FF40, 0xFF40FF40,
+  0xFFFFFFFF, 0xFF03FF03, 0xFF40FF01, 0xFF40FF40, 0xFFFFFFFF, 0xFC0FFC0F, 0xFD00FC05, 0xFF40FD40,
+  0xFFFFFFFF, 0xF03FF03F, 0xFD00F015, 0xFF40FD40, 0xFFFFFFFF, 0xC0FFC0FF, 0xFD00C055, 0xFD00FD00,
+  0xFFFFFFFF, 0x03FF03FF, 0xFD000155, 0xFD00FD00, 0xFFFFFFFF, 0x0FFF0FFF, 0xFD000D55, 0xFD00FD00,
+  0xFFFFFFFF, 0xFFF0FFFF, 0xFFD0FFF0, 0xFFD1FFC0, 0xFFFFFFFF, 0xFFC0FFFF, 0xFFC0FFC0, 0xFFD1FFC0,
+  0xFFFFFFFF, 0xFF03FFFF, 0xFF01FF03, 0xFFD1FFC0, 0xFFFFFFFF, 0xFC0FFFFF, 0xFC01FC05, 0xFFD1FFC0,
+  0xFFFFFFFF, 0xF03FFFFF, 0xF000F015, 0xFF40FF40, 0xFFFFFFFF, 0xC0FFFFFF, 0xC000C055, 0xFD00FD00,
+  0xFFFFFFFF, 0x03FFFFFF, 0x01000155, 0xFD00FD00, 0xFFFFFFFF, 0x0FFFFFFF, 0x0D000D55, 0xFD00FD00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFF0FFF0, 0xFFF6FFE0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF03FF03, 0xFF66FF00, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC01FC05, 0xFFD1FC00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF000F015, 0xFF40F000, 0xFFFFFFFF, 0xFFFFFFFF, 0xC000C055, 0xFD00C000,
+  0xFFFFFFFF, 0xFFFFFFFF, 0x01000155, 0xFD000100, 0xFFFFFFFF, 0xFFFFFFFF, 0x0D000D55, 0xFD000D00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFF0FFFF, 0xFFF0FFE0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFC0FFFF, 0xFFC0FFC0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF03FFFF, 0xFF01FF02, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC01FFD5, 0xFC01FC00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF000FF55, 0xF000F000, 0xFFFFFFFF, 0xFFFFFFFF, 0xC000FD55, 0xC000C000,
+  0xFFFFFFFF, 0xFFFFFFFF, 0x0100FD55, 0x01000100, 0xFFFFFFFF, 0xFFFFFFFF, 0x0D00FD55, 0x0D000D00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFD1FFD5, 0xFFF0FFC0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFD1FFD5, 0xFFC0FFC0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFD1FFD5, 0xFF01FF00, 0xFFFFFFFF, 0xFFFFFFFF, 0xFF41FF55, 0xFC00FC00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFD00FD55, 0xF000F000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFD00FD55, 0xC000C000,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFD00FD55, 0x01000100, 0xFFFFFFFF, 0xFFFFFFFF, 0xFD00FD55, 0x0D000D00,
+  0xFFF0FFF0, 0xFFFFFFFF, 0xF400F555, 0xF400F400, 0xFFC0FFC0, 0xFFFFFFFF, 0xF400F555, 0xF400F400,
+  0xFF03FF03, 0xFFFFFFFF, 0xF400F555, 0xF400F400, 0xFC0FFC0F, 0xFFFFFFFF, 0xF400F555, 0xF400F400,
+  0xF03FF03F, 0xFFFFFFFF, 0xF400F555, 0xF400F400, 0xC0FFC0FF, 0xFFFFFFFF, 0xF400F555, 0xF400F400,
+  0x03FF03FF, 0xFFFFFFFF, 0xF400F555, 0xF400F400, 0x0FFF0FFF, 0xFFFFFFFF, 0xF400F555, 0xF400F400,
+  0xFFF0FFF0, 0xFFFFFFF0, 0xF400F555, 0xF400F400, 0xFFC0FFC0, 0xFFFFFFC0, 0xF400F555, 0xF400F400,
+  0xFF03FF03, 0xFFFFFF03, 0xF400F555, 0xF400F400, 0xFC0FFC0F, 0xFFFFFC0F, 0xF400F555, 0xF400F400,
+  0xF03FF03F, 0xFFFFF03F, 0xF400F555, 0xF400F400, 0xC0FFC0FF, 0xFFFFC0FF, 0xF400F555, 0xF400F400,
+  0x03FF03FF, 0xFFFF03FF, 0xF400F555, 0xF400F400, 0x0FFF0FFF, 0xFFFF0FFF, 0xF400F555, 0xF400F400,
+  0xFFF0FFFF, 0xFFF0FFF0, 0xF400F555, 0xF400F400, 0xFFC0FFFF, 0xFFC0FFC0, 0xF400F555, 0xF400F400,
+  0xFF03FFFF, 0xFF03FF03, 0xF400F555, 0xF400F400, 0xFC0FFFFF, 0xFC0FFC0F, 0xF400F555, 0xF400F400,
+  0xF03FFFFF, 0xF03FF03F, 0xF400F555, 0xF400F400, 0xC0FFFFFF, 0xC0FFC0FF, 0xF400F555, 0xF400F400,
+  0x03FFFFFF, 0x03FF03FF, 0xF400F555, 0xF400F400, 0x0FFFFFFF, 0x0FFF0FFF, 0xF400F555, 0xF400F400,
+  0xFFFFFFFF, 0xFFF0FFF0, 0xFD00FD50, 0xFD01FD01, 0xFFFFFFFF, 0xFFC0FFC0, 0xFD01FD40, 0xFD01FD01,
+  0xFFFFFFFF, 0xFF03FF03, 0xFD01FD01, 0xFD01FD01, 0xFFFFFFFF, 0xFC0FFC0F, 0xFD01FC05, 0xFD01FD01,
+  0xFFFFFFFF, 0xF03FF03F, 0xF401F015, 0xFD01F501, 0xFFFFFFFF, 0xC0FFC0FF, 0xF401C055, 0xFD01F501,
+  0xFFFFFFFF, 0x03FF03FF, 0xF4000155, 0xF400F400, 0xFFFFFFFF, 0x0FFF0FFF, 0xF4000555, 0xF400F400,
+  0xFFFFFFFF, 0xFFF0FFFF, 0xFF40FF50, 0xFF47FF03, 0xFFFFFFFF, 0xFFC0FFFF, 0xFF40FFC0, 0xFF47FF03,
+  0xFFFFFFFF, 0xFF03FFFF, 0xFF03FF03, 0xFF47FF03, 0xFFFFFFFF, 0xFC0FFFFF, 0xFC07FC0F, 0xFF47FF03,
+  0xFFFFFFFF, 0xF03FFFFF, 0xF007F017, 0xFF47FF03, 0xFFFFFFFF, 0xC0FFFFFF, 0xC001C055, 0xFD01FD01,
+  0xFFFFFFFF, 0x03FFFFFF, 0x00000155, 0xF400F400, 0xFFFFFFFF, 0x0FFFFFFF, 0x04000555, 0xF400F400,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF40FF50, 0xFF47FF00, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFC0FFC0, 0xFFD9FF80,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC0FFC0F, 0xFD9FFC0B,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF007F017, 0xFF47F003, 0xFFFFFFFF, 0xFFFFFFFF, 0xC001C055, 0xFD01C001,
+  0xFFFFFFFF, 0xFFFFFFFF, 0x00000155, 0xF4000000, 0xFFFFFFFF, 0xFFFFFFFF, 0x04000555, 0xF4000400,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF40FF57, 0xFF40FF00, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFC0FFFF, 0xFFC0FF80,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF03FFFF, 0xFF03FF03, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC0FFFFF, 0xFC0FFC0B,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF007FF57, 0xF007F003, 0xFFFFFFFF, 0xFFFFFFFF, 0xC001FD55, 0xC001C001,
+  0xFFFFFFFF, 0xFFFFFFFF, 0x0000F555, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0x0400F555, 0x04000400,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF41FF55, 0xFF40FF00, 0xFFFFFFFF, 0xFFFFFFFF, 0xFF47FF57, 0xFFC0FF00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF47FF57, 0xFF03FF03, 0xFFFFFFFF, 0xFFFFFFFF, 0xFF47FF57, 0xFC0FFC03,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFD07FD57, 0xF007F003, 0xFFFFFFFF, 0xFFFFFFFF, 0xF401F555, 0xC001C001,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF400F555, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xF400F555, 0x04000400,
+  0xFFF0FFF0, 0xFFFFFFFF, 0xD001D555, 0xD001D001, 0xFFC0FFC0, 0xFFFFFFFF, 0xD001D555, 0xD001D001,
+  0xFF03FF03, 0xFFFFFFFF, 0xD001D555, 0xD001D001, 0xFC0FFC0F, 0xFFFFFFFF, 0xD001D555, 0xD001D001,
+  0xF03FF03F, 0xFFFFFFFF, 0xD001D555, 0xD001D001, 0xC0FFC0FF, 0xFFFFFFFF, 0xD001D555, 0xD001D001,
+  0x03FF03FF, 0xFFFFFFFF, 0xD001D555, 0xD001D001, 0x0FFF0FFF, 0xFFFFFFFF, 0xD001D555, 0xD001D001,
+  0xFFF0FFF0, 0xFFFFFFF0, 0xD001D555, 0xD001D001, 0xFFC0FFC0, 0xFFFFFFC0, 0xD001D555, 0xD001D001,
+  0xFF03FF03, 0xFFFFFF03, 0xD001D555, 0xD001D001, 0xFC0FFC0F, 0xFFFFFC0F, 0xD001D555, 0xD001D001,
+  0xF03FF03F, 0xFFFFF03F, 0xD001D555, 0xD001D001, 0xC0FFC0FF, 0xFFFFC0FF, 0xD001D555, 0xD001D001,
+  0x03FF03FF, 0xFFFF03FF, 0xD001D555, 0xD001D001, 0x0FFF0FFF, 0xFFFF0FFF, 0xD001D555, 0xD001D001,
+  0xFFF0FFFF, 0xFFF0FFF0, 0xD001D555, 0xD001D001, 0xFFC0FFFF, 0xFFC0FFC0, 0xD001D555, 0xD001D001,
+  0xFF03FFFF, 0xFF03FF03, 0xD001D555, 0xD001D001, 0xFC0FFFFF, 0xFC0FFC0F, 0xD001D555, 0xD001D001,
+  0xF03FFFFF, 0xF03FF03F, 0xD001D555, 0xD001D001, 0xC0FFFFFF, 0xC0FFC0FF, 0xD001D555, 0xD001D001,
+  0x03FFFFFF, 0x03FF03FF, 0xD001D555, 0xD001D001, 0x0FFFFFFF, 0x0FFF0FFF, 0xD001D555, 0xD001D001,
+  0xFFFFFFFF, 0xFFF0FFF0, 0xF401F550, 0xF407F405, 0xFFFFFFFF, 0xFFC0FFC0, 0xF401F540, 0xF407F405,
+  0xFFFFFFFF, 0xFF03FF03, 0xF407F503, 0xF407F407, 0xFFFFFFFF, 0xFC0FFC0F, 0xF407F407, 0xF407F407,
+  0xFFFFFFFF, 0xF03FF03F, 0xF407F017, 0xF407F407, 0xFFFFFFFF, 0xC0FFC0FF, 0xD007C057, 0xF407D407,
+  0xFFFFFFFF, 0x03FF03FF, 0xD0070157, 0xF407D407, 0xFFFFFFFF, 0x0FFF0FFF, 0xD0010555, 0xD001D001,
+  0xFFFFFFFF, 0xFFF0FFFF, 0xF400F550, 0xF407F407, 0xFFFFFFFF, 0xFFC0FFFF, 0xFD00FD40, 0xFD1FFC0F,
+  0xFFFFFFFF, 0xFF03FFFF, 0xFD03FF03, 0xFD1FFC0F, 0xFFFFFFFF, 0xFC0FFFFF, 0xFC0FFC0F, 0xFD1FFC0F,
+  0xFFFFFFFF, 0xF03FFFFF, 0xF01FF03F, 0xFD1FFC0F, 0xFFFFFFFF, 0xC0FFFFFF, 0xC01FC05F, 0xFD1FFC0F,
+  0xFFFFFFFF, 0x03FFFFFF, 0x00070157, 0xF407F407, 0xFFFFFFFF, 0x0FFFFFFF, 0x00010555, 0xD001D001,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF400F550, 0xF407F400, 0xFFFFFFFF, 0xFFFFFFFF, 0xFD00FD40, 0xFD1FFC00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF03FF03, 0xFF67FE03, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF03FF03F, 0xF67FF02F, 0xFFFFFFFF, 0xFFFFFFFF, 0xC01FC05F, 0xFD1FC00F,
+  0xFFFFFFFF, 0xFFFFFFFF, 0x00070157, 0xF4070007, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010555, 0xD0010001,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF400F557, 0xF400F400, 0xFFFFFFFF, 0xFFFFFFFF, 0xFD00FD5F, 0xFD00FC00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF03FFFF, 0xFF03FE03, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC0FFFFF, 0xFC0FFC0F,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF03FFFFF, 0xF03FF02F, 0xFFFFFFFF, 0xFFFFFFFF, 0xC01FFD5F, 0xC01FC00F,
+  0xFFFFFFFF, 0xFFFFFFFF, 0x0007F557, 0x00070007, 0xFFFFFFFF, 0xFFFFFFFF, 0x0001D555, 0x00010001,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF401F555, 0xF400F400, 0xFFFFFFFF, 0xFFFFFFFF, 0xFD07FD57, 0xFD00FC00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFD1FFD5F, 0xFF03FC03, 0xFFFFFFFF, 0xFFFFFFFF, 0xFD1FFD5F, 0xFC0FFC0F,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFD1FFD5F, 0xF03FF00F, 0xFFFFFFFF, 0xFFFFFFFF, 0xF41FF55F, 0xC01FC00F,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xD007D557, 0x00070007, 0xFFFFFFFF, 0xFFFFFFFF, 0xD001D555, 0x00010001,
+  0xFFF0FFF0, 0xFFFFFFFF, 0xFFD5FFFF, 0xFFD0FFD0, 0xFFC0FFC0, 0xFFFFFFFF, 0xFFD5FFFF, 0xFFD0FFD0,
+  0xFF03FF03, 0xFFFFFFFF, 0xFFD5FFFF, 0xFFD0FFD0, 0xFC0FFC0F, 0xFFFFFFFF, 0xFFD5FFFF, 0xFFD0FFD0,
+  0xF03FF03F, 0xFFFFFFFF, 0xFFD5FFFF, 0xFFD0FFD0, 0xC0FFC0FF, 0xFFFFFFFF, 0xFFD5FFFF, 0xFFD0FFD0,
+  0x03FF03FF, 0xFFFFFFFF, 0xFFD5FFFF, 0xFFD0FFD0, 0x0FFF0FFF, 0xFFFFFFFF, 0xFFD5FFFF, 0xFFD0FFD0,
+  0xFFF0FFF0, 0xFFFFFFF0, 0xFFD5FFFF, 0xFFD0FFD0, 0xFFC0FFC0, 0xFFFFFFC0, 0xFFD5FFFF, 0xFFD0FFD0,
+  0xFF03FF03, 0xFFFFFF03, 0xFFD5FFFF, 0xFFD0FFD0, 0xFC0FFC0F, 0xFFFFFC0F, 0xFFD5FFFF, 0xFFD0FFD0,
+  0xF03FF03F, 0xFFFFF03F, 0xFFD5FFFF, 0xFFD0FFD0, 0xC0FFC0FF, 0xFFFFC0FF, 0xFFD5FFFF, 0xFFD0FFD0,
+  0x03FF03FF, 0xFFFF03FF, 0xFFD5FFFF, 0xFFD0FFD0, 0x0FFF0FFF, 0xFFFF0FFF, 0xFFD5FFFF, 0xFFD0FFD0,
+  0xFFF0FFFF, 0xFFF0FFF0, 0xFFD5FFFF, 0xFFD0FFD0, 0xFFC0FFFF, 0xFFC0FFC0, 0xFFD5FFFF, 0xFFD0FFD0,
+  0xFF03FFFF, 0xFF03FF03, 0xFFD5FFFF, 0xFFD0FFD0, 0xFC0FFFFF, 0xFC0FFC0F, 0xFFD5FFFF, 0xFFD0FFD0,
+  0xF03FFFFF, 0xF03FF03F, 0xFFD5FFFF, 0xFFD0FFD0, 0xC0FFFFFF, 0xC0FFC0FF, 0xFFD5FFFF, 0xFFD0FFD0,
+  0x03FFFFFF, 0x03FF03FF, 0xFFD5FFFF, 0xFFD0FFD0, 0x0FFFFFFF, 0x0FFF0FFF, 0xFFD5FFFF, 0xFFD0FFD0,
+  0xFFFFFFFF, 0xFFF0FFF0, 0xFFD5FFF0, 0xFFD0FFD0, 0xFFFFFFFF, 0xFFC0FFC0, 0xFFD5FFC0, 0xFFD0FFD0,
+  0xFFFFFFFF, 0xFF03FF03, 0xFFD5FF03, 0xFFD0FFD0, 0xFFFFFFFF, 0xFC0FFC0F, 0xFFD5FC0F, 0xFFD0FFD0,
+  0xFFFFFFFF, 0xF03FF03F, 0xFFD5F03F, 0xFFD0FFD0, 0xFFFFFFFF, 0xC0FFC0FF, 0xFFD5C0FF, 0xFFD0FFD0,
+  0xFFFFFFFF, 0x03FF03FF, 0xFFD503FF, 0xFFD0FFD0, 0xFFFFFFFF, 0x0FFF0FFF, 0xFFD50FFF, 0xFFD0FFD0,
+  0xFFFFFFFF, 0xFFF0FFFF, 0xFFD0FFF0, 0xFFD0FFD0, 0xFFFFFFFF, 0xFFC0FFFF, 0xFFC0FFC0, 0xFFD0FFD0,
+  0xFFFFFFFF, 0xFF03FFFF, 0xFF01FF03, 0xFFD0FFD0, 0xFFFFFFFF, 0xFC0FFFFF, 0xFC05FC0F, 0xFFD0FFD0,
+  0xFFFFFFFF, 0xF03FFFFF, 0xF015F03F, 0xFFD0FFD0, 0xFFFFFFFF, 0xC0FFFFFF, 0xC0D5C0FF, 0xFFD0FFD0,
+  0xFFFFFFFF, 0x03FFFFFF, 0x03D503FF, 0xFFD0FFD0, 0xFFFFFFFF, 0x0FFFFFFF, 0x0FD50FFF, 0xFFD0FFD0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFF0FFF0, 0xFFF0FFF0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFC0FFC0, 0xFFF0FFC0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF01FF03, 0xFFF0FF00, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC05FC0F, 0xFFD0FC00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF015F03F, 0xFFD0F010, 0xFFFFFFFF, 0xFFFFFFFF, 0xC0D5C0FF, 0xFFD0C0D0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0x03D503FF, 0xFFD003D0, 0xFFFFFFFF, 0xFFFFFFFF, 0x0FD50FFF, 0xFFD00FD0,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFC0FFFF, 0xFFC0FFC0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF01FFFF, 0xFF00FF00, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC05FFFF, 0xFC00FC00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF015FFFF, 0xF010F010, 0xFFFFFFFF, 0xFFFFFFFF, 0xC0D5FFFF, 0xC0D0C0D0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0x03D5FFFF, 0x03D003D0, 0xFFFFFFFF, 0xFFFFFFFF, 0x0FD5FFFF, 0x0FD00FD0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF57FFFF, 0xFF40FF40, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFC0FFC0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFF5FFFF, 0xFF00FF00, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFD5FFFF, 0xFC00FC00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFD5FFFF, 0xF010F010, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFD5FFFF, 0xC0D0C0D0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFD5FFFF, 0x03D003D0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFD5FFFF, 0x0FD00FD0,
+  0xFFF0FFF0, 0xFFFFFFFF, 0xFF55FFFF, 0xFF40FF40, 0xFFC0FFC0, 0xFFFFFFFF, 0xFF55FFFF, 0xFF40FF40,
+  0xFF03FF03, 0xFFFFFFFF, 0xFF55FFFF, 0xFF40FF40, 0xFC0FFC0F, 0xFFFFFFFF, 0xFF55FFFF, 0xFF40FF40,
+  0xF03FF03F, 0xFFFFFFFF, 0xFF55FFFF, 0xFF40FF40, 0xC0FFC0FF, 0xFFFFFFFF, 0xFF55FFFF, 0xFF40FF40,
+  0x03FF03FF, 0xFFFFFFFF, 0xFF55FFFF, 0xFF40FF40, 0x0FFF0FFF, 0xFFFFFFFF, 0xFF55FFFF, 0xFF40FF40,
+  0xFFF0FFF0, 0xFFFFFFF0, 0xFF55FFFF, 0xFF40FF40, 0xFFC0FFC0, 0xFFFFFFC0, 0xFF55FFFF, 0xFF40FF40,
+  0xFF03FF03, 0xFFFFFF03, 0xFF55FFFF, 0xFF40FF40, 0xFC0FFC0F, 0xFFFFFC0F, 0xFF55FFFF, 0xFF40FF40,
+  0xF03FF03F, 0xFFFFF03F, 0xFF55FFFF, 0xFF40FF40, 0xC0FFC0FF, 0xFFFFC0FF, 0xFF55FFFF, 0xFF40FF40,
+  0x03FF03FF, 0xFFFF03FF, 0xFF55FFFF, 0xFF40FF40, 0x0FFF0FFF, 0xFFFF0FFF, 0xFF55FFFF, 0xFF40FF40,
+  0xFFF0FFFF, 0xFFF0FFF0, 0xFF55FFFF, 0xFF40FF40, 0xFFC0FFFF, 0xFFC0FFC0, 0xFF55FFFF, 0xFF40FF40,
+  0xFF03FFFF, 0xFF03FF03, 0xFF55FFFF, 0xFF40FF40, 0xFC0FFFFF, 0xFC0FFC0F, 0xFF55FFFF, 0xFF40FF40,
+  0xF03FFFFF, 0xF03FF03F, 0xFF55FFFF, 0xFF40FF40, 0xC0FFFFFF, 0xC0FFC0FF, 0xFF55FFFF, 0xFF40FF40,
+  0x03FFFFFF, 0x03FF03FF, 0xFF55FFFF, 0xFF40FF40, 0x0FFFFFFF, 0x0FFF0FFF, 0xFF55FFFF, 0xFF40FF40,
+  0xFFFFFFFF, 0xFFF0FFF0, 0xFF55FFF0, 0xFF40FF40, 0xFFFFFFFF, 0xFFC0FFC0, 0xFF55FFC0, 0xFF40FF40,
+  0xFFFFFFFF, 0xFF03FF03, 0xFF55FF03, 0xFF40FF40, 0xFFFFFFFF, 0xFC0FFC0F, 0xFF55FC0F, 0xFF40FF40,
+  0xFFFFFFFF, 0xF03FF03F, 0xFF55F03F, 0xFF40FF40, 0xFFFFFFFF, 0xC0FFC0FF, 0xFF55C0FF, 0xFF40FF40,
+  0xFFFFFFFF, 0x03FF03FF, 0xFF5503FF, 0xFF40FF40, 0xFFFFFFFF, 0x0FFF0FFF, 0xFF550FFF, 0xFF40FF40,
+  0xFFFFFFFF, 0xFFF0FFFF, 0xFF50FFF0, 0xFF44FF40, 0xFFFFFFFF, 0xFFC0FFFF, 0xFF40FFC0, 0xFF44FF40,
+  0xFFFFFFFF, 0xFF03FFFF, 0xFF01FF03, 0xFF44FF40, 0xFFFFFFFF, 0xFC0FFFFF, 0xFC05FC0F, 0xFF44FF40,
+  0xFFFFFFFF, 0xF03FFFFF, 0xF015F03F, 0xFF40FF40, 0xFFFFFFFF, 0xC0FFFFFF, 0xC055C0FF, 0xFF40FF40,
+  0xFFFFFFFF, 0x03FFFFFF, 0x035503FF, 0xFF40FF40, 0xFFFFFFFF, 0x0FFFFFFF, 0x0F550FFF, 0xFF40FF40,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFF0FFF0, 0xFFC8FFD0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFC0FFC0, 0xFFE6FFC0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF03FF03, 0xFFC8FF01, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC05FC0F, 0xFFC4FC01,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF015F03F, 0xFF40F000, 0xFFFFFFFF, 0xFFFFFFFF, 0xC055C0FF, 0xFF40C040,
+  0xFFFFFFFF, 0xFFFFFFFF, 0x035503FF, 0xFF400340, 0xFFFFFFFF, 0xFFFFFFFF, 0x0F550FFF, 0xFF400F40,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFF0FFFF, 0xFFE0FFF0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF03FFFF, 0xFF02FF03, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC05FFFF, 0xFC04FC01,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF015FFFF, 0xF000F000, 0xFFFFFFFF, 0xFFFFFFFF, 0xC055FFFF, 0xC040C040,
+  0xFFFFFFFF, 0xFFFFFFFF, 0x0355FFFF, 0x03400340, 0xFFFFFFFF, 0xFFFFFFFF, 0x0F55FFFF, 0x0F400F40,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFE0FFF0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFC0FFC0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFF02FF03, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFD5FFFF, 0xFC00FC01,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF55FFFF, 0xF000F000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFF55FFFF, 0xC040C040,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF55FFFF, 0x03400340, 0xFFFFFFFF, 0xFFFFFFFF, 0xFF55FFFF, 0x0F400F40,
+  0xFFF0FFF0, 0xFFFFFFFF, 0xFD55FFFF, 0xFD01FD01, 0xFFC0FFC0, 0xFFFFFFFF, 0xFD55FFFF, 0xFD01FD01,
+  0xFF03FF03, 0xFFFFFFFF, 0xFD55FFFF, 0xFD01FD01, 0xFC0FFC0F, 0xFFFFFFFF, 0xFD55FFFF, 0xFD01FD01,
+  0xF03FF03F, 0xFFFFFFFF, 0xFD55FFFF, 0xFD01FD01, 0xC0FFC0FF, 0xFFFFFFFF, 0xFD55FFFF, 0xFD01FD01,
+  0x03FF03FF, 0xFFFFFFFF, 0xFD55FFFF, 0xFD01FD01, 0x0FFF0FFF, 0xFFFFFFFF, 0xFD55FFFF, 0xFD01FD01,
+  0xFFF0FFF0, 0xFFFFFFF0, 0xFD55FFFF, 0xFD01FD01, 0xFFC0FFC0, 0xFFFFFFC0, 0xFD55FFFF, 0xFD01FD01,
+  0xFF03FF03, 0xFFFFFF03, 0xFD55FFFF, 0xFD01FD01, 0xFC0FFC0F, 0xFFFFFC0F, 0xFD55FFFF, 0xFD01FD01,
+  0xF03FF03F, 0xFFFFF03F, 0xFD55FFFF, 0xFD01FD01, 0xC0FFC0FF, 0xFFFFC0FF, 0xFD55FFFF, 0xFD01FD01,
+  0x03FF03FF, 0xFFFF03FF, 0xFD55FFFF, 0xFD01FD01, 0x0FFF0FFF, 0xFFFF0FFF, 0xFD55FFFF, 0xFD01FD01,
+  0xFFF0FFFF, 0xFFF0FFF0, 0xFD55FFFF, 0xFD01FD01, 0xFFC0FFFF, 0xFFC0FFC0, 0xFD55FFFF, 0xFD01FD01,
+  0xFF03FFFF, 0xFF03FF03, 0xFD55FFFF, 0xFD01FD01, 0xFC0FFFFF, 0xFC0FFC0F, 0xFD55FFFF, 0xFD01FD01,
+  0xF03FFFFF, 0xF03FF03F, 0xFD55FFFF, 0xFD01FD01, 0xC0FFFFFF, 0xC0FFC0FF, 0xFD55FFFF, 0xFD01FD01,
+  0x03FFFFFF, 0x03FF03FF, 0xFD55FFFF, 0xFD01FD01, 0x0FFFFFFF, 0x0FFF0FFF, 0xFD55FFFF, 0xFD01FD01,
+  0xFFFFFFFF, 0xFFF0FFF0, 0xFD55FFF0, 0xFD01FD01, 0xFFFFFFFF, 0xFFC0FFC0, 0xFD55FFC0, 0xFD01FD01,
+  0xFFFFFFFF, 0xFF03FF03, 0xFD55FF03, 0xFD01FD01, 0xFFFFFFFF, 0xFC0FFC0F, 0xFD55FC0F, 0xFD01FD01,
+  0xFFFFFFFF, 0xF03FF03F, 0xFD55F03F, 0xFD01FD01, 0xFFFFFFFF, 0xC0FFC0FF, 0xFD55C0FF, 0xFD01FD01,
+  0xFFFFFFFF, 0x03FF03FF, 0xFD5503FF, 0xFD01FD01, 0xFFFFFFFF, 0x0FFF0FFF, 0xFD550FFF, 0xFD01FD01,
+  0xFFFFFFFF, 0xFFF0FFFF, 0xFD50FFF0, 0xFD11FD01, 0xFFFFFFFF, 0xFFC0FFFF, 0xFD40FFC0, 0xFD11FD01,
+  0xFFFFFFFF, 0xFF03FFFF, 0xFD01FF03, 0xFD11FD01, 0xFFFFFFFF, 0xFC0FFFFF, 0xFC05FC0F, 0xFD11FD01,
+  0xFFFFFFFF, 0xF03FFFFF, 0xF015F03F, 0xFD11FD01, 0xFFFFFFFF, 0xC0FFFFFF, 0xC055C0FF, 0xFD01FD01,
+  0xFFFFFFFF, 0x03FFFFFF, 0x015503FF, 0xFD01FD01, 0xFFFFFFFF, 0x0FFFFFFF, 0x0D550FFF, 0xFD01FD01,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF50FFF0, 0xFF11FF40, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFC0FFC0, 0xFF21FF40,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF03FF03, 0xFF9BFF03, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC0FFC0F, 0xFF23FC07,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF017F03F, 0xFF13F007, 0xFFFFFFFF, 0xFFFFFFFF, 0xC055C0FF, 0xFD01C001,
+  0xFFFFFFFF, 0xFFFFFFFF, 0x015503FF, 0xFD010101, 0xFFFFFFFF, 0xFFFFFFFF, 0x0D550FFF, 0xFD010D01,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF50FFFF, 0xFF10FF40, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFC0FFFF, 0xFF80FFC0,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC0FFFFF, 0xFC0BFC0F,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF017FFFF, 0xF013F007, 0xFFFFFFFF, 0xFFFFFFFF, 0xC055FFFF, 0xC001C001,
+  0xFFFFFFFF, 0xFFFFFFFF, 0x0155FFFF, 0x01010101, 0xFFFFFFFF, 0xFFFFFFFF, 0x0D55FFFF, 0x0D010D01,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF57FFFF, 0xFF00FF40, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFF80FFC0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFF03FF03, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC0BFC0F,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF57FFFF, 0xF003F007, 0xFFFFFFFF, 0xFFFFFFFF, 0xFD55FFFF, 0xC001C001,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFD55FFFF, 0x01010101, 0xFFFFFFFF, 0xFFFFFFFF, 0xFD55FFFF, 0x0D010D01,
+  0xFFF0FFF0, 0xFFFFFFFF, 0xF557FFFF, 0xF407F407, 0xFFC0FFC0, 0xFFFFFFFF, 0xF557FFFF, 0xF407F407,
+  0xFF03FF03, 0xFFFFFFFF, 0xF557FFFF, 0xF407F407, 0xFC0FFC0F, 0xFFFFFFFF, 0xF557FFFF, 0xF407F407,
+  0xF03FF03F, 0xFFFFFFFF, 0xF557FFFF, 0xF407F407, 0xC0FFC0FF, 0xFFFFFFFF, 0xF557FFFF, 0xF407F407,
+  0x03FF03FF, 0xFFFFFFFF, 0xF557FFFF, 0xF407F407, 0x0FFF0FFF, 0xFFFFFFFF, 0xF557FFFF, 0xF407F407,
+  0xFFF0FFF0, 0xFFFFFFF0, 0xF557FFFF, 0xF407F407, 0xFFC0FFC0, 0xFFFFFFC0, 0xF557FFFF, 0xF407F407,
+  0xFF03FF03, 0xFFFFFF03, 0xF557FFFF, 0xF407F407, 0xFC0FFC0F, 0xFFFFFC0F, 0xF557FFFF, 0xF407F407,
+  0xF03FF03F, 0xFFFFF03F, 0xF557FFFF, 0xF407F407, 0xC0FFC0FF, 0xFFFFC0FF, 0xF557FFFF, 0xF407F407,
+  0x03FF03FF, 0xFFFF03FF, 0xF557FFFF, 0xF407F407, 0x0FFF0FFF, 0xFFFF0FFF, 0xF557FFFF, 0xF407F407,
+  0xFFF0FFFF, 0xFFF0FFF0, 0xF557FFFF, 0xF407F407, 0xFFC0FFFF, 0xFFC0FFC0, 0xF557FFFF, 0xF407F407,
+  0xFF03FFFF, 0xFF03FF03, 0xF557FFFF, 0xF407F407, 0xFC0FFFFF, 0xFC0FFC0F, 0xF557FFFF, 0xF407F407,
+  0xF03FFFFF, 0xF03FF03F, 0xF557FFFF, 0xF407F407, 0xC0FFFFFF, 0xC0FFC0FF, 0xF557FFFF, 0xF407F407,
+  0x03FFFFFF, 0x03FF03FF, 0xF557FFFF, 0xF407F407, 0x0FFFFFFF, 0x0FFF0FFF, 0xF557FFFF, 0xF407F407,
+  0xFFFFFFFF, 0xFFF0FFF0, 0xF557FFF0, 0xF407F407, 0xFFFFFFFF, 0xFFC0FFC0, 0xF557FFC0, 0xF407F407,
+  0xFFFFFFFF, 0xFF03FF03, 0xF557FF03, 0xF407F407, 0xFFFFFFFF, 0xFC0FFC0F, 0xF557FC0F, 0xF407F407,
+  0xFFFFFFFF, 0xF03FF03F, 0xF557F03F, 0xF407F407, 0xFFFFFFFF, 0xC0FFC0FF, 0xF557C0FF, 0xF407F407,
+  0xFFFFFFFF, 0x03FF03FF, 0xF55703FF, 0xF407F407, 0xFFFFFFFF, 0x0FFF0FFF, 0xF5570FFF, 0xF407F407,
+  0xFFFFFFFF, 0xFFF0FFFF, 0xF550FFF0, 0xF407F407, 0xFFFFFFFF, 0xFFC0FFFF, 0xF540FFC0, 0xF447F407,
+  0xFFFFFFFF, 0xFF03FFFF, 0xF503FF03, 0xF447F407, 0xFFFFFFFF, 0xFC0FFFFF, 0xF407FC0F, 0xF447F407,
+  0xFFFFFFFF, 0xF03FFFFF, 0xF017F03F, 0xF447F407, 0xFFFFFFFF, 0xC0FFFFFF, 0xC057C0FF, 0xF447F407,
+  0xFFFFFFFF, 0x03FFFFFF, 0x015703FF, 0xF407F407, 0xFFFFFFFF, 0x0FFFFFFF, 0x05570FFF, 0xF407F407,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF550FFF0, 0xF407F400, 0xFFFFFFFF, 0xFFFFFFFF, 0xFD40FFC0, 0xFC4FFD00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF03FF03, 0xFC8FFD03, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC0FFC0F, 0xFE6FFC0F,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF03FF03F, 0xFC8FF01F, 0xFFFFFFFF, 0xFFFFFFFF, 0xC05FC0FF, 0xFC4FC01F,
+  0xFFFFFFFF, 0xFFFFFFFF, 0x015703FF, 0xF4070007, 0xFFFFFFFF, 0xFFFFFFFF, 0x05570FFF, 0xF4070407,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF550FFFF, 0xF400F400, 0xFFFFFFFF, 0xFFFFFFFF, 0xFD40FFFF, 0xFC40FD00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF03FFFF, 0xFE03FF03, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF03FFFFF, 0xF02FF03F, 0xFFFFFFFF, 0xFFFFFFFF, 0xC05FFFFF, 0xC04FC01F,
+  0xFFFFFFFF, 0xFFFFFFFF, 0x0157FFFF, 0x00070007, 0xFFFFFFFF, 0xFFFFFFFF, 0x0557FFFF, 0x04070407,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF557FFFF, 0xF400F400, 0xFFFFFFFF, 0xFFFFFFFF, 0xFD5FFFFF, 0xFC00FD00,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFE03FF03, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC0FFC0F,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xF02FF03F, 0xFFFFFFFF, 0xFFFFFFFF, 0xFD5FFFFF, 0xC00FC01F,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF557FFFF, 0x00070007, 0xFFFFFFFF, 0xFFFFFFFF, 0xF557FFFF, 0x04070407
+};
+
+}
+
+#endif // !defined(KPKBITBASE_H_INCLUDED)
@@ -29,7 +29,9 @@
 #include "position.h"
 #include "thread.h"
 #include "search.h"
+#include "similarity_test.h"
 #include "ucioption.h"
+#include "uctsearch.h"
 
 #ifdef USE_CALLGRIND
 #include <valgrind/callgrind.h>
@@ -39,10 +41,13 @@ using namespace std;
 
 extern bool execute_uci_command(const string& cmd);
 extern void benchmark(int argc, char* argv[]);
-extern void init_kpk_bitbase();
+extern bool perft_suite(const string& fileName, int maxDepth);
+extern void print_kpk_bitbase();
 
 int main(int argc, char* argv[]) {
 
+  int exitCode = EXIT_SUCCESS;
+
   // Disable IO buffering for C and C++ standard libraries
   setvbuf(stdin, NULL, _IONBF, 0);
   setvbuf(stdout, NULL, _IONBF, 0);
@@ -53,7 +58,6 @@ int main(int argc, char* argv[]) {
   init_bitboards();
   Position::init_zobrist();
   Position::init_piece_square_tables();
-  init_kpk_bitbase();
   init_search();
   Threads.init();
 
@@ -69,6 +73,9 @@ int main(int argc, char* argv[]) {
       if (CpuHasPOPCNT)
           cout << "Good! CPU has hardware POPCNT." << endl;
 
+      if (CpuHasPEXT)
+          cout << "Good! CPU has hardware PEXT." << endl;
+
       // Wait for a command from the user, and passes this command to
       // execute_uci_command() and also intercepts EOF from stdin to
       // ensure that we exit gracefully if the GUI dies unexpectedly.
@@ -77,11 +84,23 @@ int main(int argc, char* argv[]) {
   }
   else if (string(argv[1]) == "bench" && argc < 8)
       benchmark(argc, argv);
+  else if (string(argv[1]) == "perftsuite" && argc < 5)
+      exitCode = perft_suite(argc > 3 ? argv[3] : TEST_DIR + "perft_suite.in",
+                             argc > 2 ? atoi(argv[2]) : PLY_MAX) ? EXIT_SUCCESS : EXIT_FAILURE;
+  else if (string(argv[1]) == "trapcheck" && argc < 4)
+      exitCode = trapSuite(argc > 2 ? argv[2] : TEST_DIR + "trap_suite.in") ? EXIT_SUCCESS : EXIT_FAILURE;
+  else if (string(argv[1]) == "kpkgen" && argc == 2)
+      print_kpk_bitbase();
   else
       cout << "Usage: stockfish bench [hash size = 128] [threads = 1] "
            << "[limit = 12] [fen positions file = default] "
-           << "[limited by depth, time, nodes or perft = depth]" << endl;
+           << "[limited by depth, time, nodes or perft = depth]"
+           << "\n       stockfish perftsuite [max depth = all] "
+           << "[suite file = " << TEST_DIR << "perft_suite.in]"
+           << "\n       stockfish trapcheck [suite file = " << TEST_DIR << "trap_suite.in]"
+           << "\n       stockfish kpkgen > kpkbitbase.h" << endl;
 
+  uct_exit();
   Threads.exit();
-  return 0;
+  return exitCode;
 }
@@ -69,6 +69,7 @@ public:
   void init();
   MaterialInfo* get_material_info(const Position& pos) const;
   static Phase game_phase(const Position& pos);
+  Endgames* endgames() const { return funcs; }
 
 private:
   template<Color Us>
@@ -150,6 +150,24 @@ int get_system_time() {
 }
 
 
+/// get_system_time_us() returns the current system time, measured in
+/// microseconds. Used where the millisecond clock is too coarse.
+
+int64_t get_system_time_us() {
+
+#if defined(_MSC_VER)
+  LARGE_INTEGER f, t;
+  QueryPerformanceFrequency(&f);
+  QueryPerformanceCounter(&t);
+  return int64_t(t.QuadPart / f.QuadPart) * 1000000 + int64_t(t.QuadPart % f.QuadPart) * 1000000 / f.QuadPart;
+#else
+  struct timeval t;
+  gettimeofday(&t, NULL);
+  return int64_t(t.tv_sec) * 1000000 + t.tv_usec;
+#endif
+}
+
+
 /// cpu_count() tries to detect the number of CPU cores
 
 int cpu_count() {
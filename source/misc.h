@@ -26,6 +26,7 @@
 extern const std::string engine_name();
 extern const std::string engine_authors();
 extern int get_system_time();
+extern int64_t get_system_time_us();
 extern int cpu_count();
 extern int input_available();
 extern void prefetch(char* addr);
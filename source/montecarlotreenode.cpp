@@ -1,6 +1,7 @@
 #include "montecarlotreenode.h"
 
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include <vector>
@@ -10,9 +11,115 @@
 #include "position.h"
 #include "rkiss.h"
 #include "evaluate.h"
+#include "misc.h"
+#include "thread.h"
 #include "uctsearch.h"
 
-static RKISS rk;
+// One playout PRNG stream per thread, all derived from a single master seed
+static RKISS rk[MAX_THREADS];
+
+// Weight of the minimax backed heuristic value in the selection, 0 disables implicit minimax
+static double minimaxWeight;
+
+// Reseeds the playout streams, a fixed seed gives reproducible searches
+void seed_playouts(uint64_t seed) {
+	for (int i = 0; i < MAX_THREADS; i++)
+		rk[i].seed(seed + i * 0x9E3779B97F4A7C15ULL);
+}
+
+namespace {
+
+	// Playout outcome cache. An entry packs the white win, draw and black win
+	// counts of the playouts through a position into a data word, stored with
+	// the position key xor-ed with the data, so that it can be read and written
+	// by all the playout threads without locking: an entry torn by two threads
+	// writing at once fails the key check. A concurrent update may get lost,
+	// which is harmless for statistics.
+	const int CountBits = 10;
+	const int CountMax = (1 << CountBits) - 1;
+
+	struct CacheEntry {
+		volatile uint64_t check, data;
+	};
+
+	CacheEntry * playoutCache;
+	bool usePlayoutCache;
+
+	inline CacheEntry * cache_entry(Key key) {
+		return playoutCache + (uint32_t(key) & (PLAYOUT_CACHE_SIZE - 1));
+	}
+
+	// Reads the data word of a position, returns false if it is not cached
+	inline bool cache_probe(Key key, uint64_t & data) {
+		const CacheEntry * e = cache_entry(key);
+		uint64_t check = e->check;
+		data = e->data;
+		return (check ^ data) == key;
+	}
+
+	// Preloads the entry of a position about to be reached, its key being
+	// predicted with Position::key_after(), so that the memory access overlaps
+	// with the work done until the entry is read. The callers check that the
+	// cache is on before paying for key_after().
+	inline void cache_prefetch(Key key) {
+		prefetch((char*)cache_entry(key));
+	}
+
+	inline int cache_count(uint64_t e, int outcome) {
+		return int(e >> (outcome * CountBits)) & CountMax;
+	}
+
+	// Outcome index of a playout result: white win, draw or black win
+	inline int outcome_of(double result) {
+		return result >= 0.75 ? 0 : result <= 0.25 ? 2 : 1;
+	}
+
+	void cache_record(Key key, double result) {
+		uint64_t v;
+		int c[3] = { 0, 0, 0 };
+
+		if (cache_probe(key, v))
+			for (int i = 0; i < 3; i++)
+				c[i] = cache_count(v, i);
+
+		// Halve the counts on overflow, this also ages old outcomes
+		if (++c[outcome_of(result)] > CountMax)
+			for (int i = 0; i < 3; i++)
+				c[i] >>= 1;
+
+		CacheEntry * e = cache_entry(key);
+		v = uint64_t(c[0]) | uint64_t(c[1]) << CountBits | uint64_t(c[2]) << (2 * CountBits);
+		e->data = v;
+		e->check = key ^ v;
+	}
+
+	// Samples a result from the cached outcomes of a position, returns -1
+	// if the position is not cached or has not enough samples yet.
+	double cache_sample(Key key, RKISS & rng) {
+		uint64_t v;
+
+		if (!cache_probe(key, v))
+			return -1;
+
+		int w = cache_count(v, 0), d = cache_count(v, 1), l = cache_count(v, 2);
+		if (w + d + l < PLAYOUT_CACHE_MIN_SAMPLES)
+			return -1;
+
+		int r = rng.rand<unsigned int>() % (w + d + l);
+		return r < w ? 1 : r < w + d ? 0.5 : 0;
+	}
+}
+
+// Enables or disables the playout outcome cache and clears it for a new search
+void init_playout_cache(bool enabled) {
+	usePlayoutCache = enabled;
+	if (!usePlayoutCache)
+		return;
+
+	if (!playoutCache)
+		playoutCache = new CacheEntry[PLAYOUT_CACHE_SIZE];
+	memset(playoutCache, 0, PLAYOUT_CACHE_SIZE * sizeof(CacheEntry));
+}
 
 // Class Constructor, initializes node variables
 MonteCarloTreeNode::MonteCarloTreeNode(Move move, MonteCarloTreeNode * parentNode, Value score) {
@@ -22,6 +129,7 @@ MonteCarloTreeNode::MonteCarloTreeNode(Move move, MonteCarloTreeNode * parentNod
 	parent = parentNode;
 	lastMove = move;
 	heuristicScore = score;
+	minimaxValue = win_probability(score);
 	simcounter = 1; // NEW
 }
 
@@ -43,6 +151,28 @@ MonteCarloTreeNode * MonteCarloTreeNode::addChild(Move move, Value score) {
 	return child;
 }
 
+// Converts an evaluation into a win probability for the side it is relative to
+double win_probability(Value v) {
+	return 1 / (1 + exp(-double(v) / EVAL_WIN_SCALE));
+}
+
+void set_implicit_minimax(double weight) {
+	minimaxWeight = weight;
+}
+
+// Backs up the heuristic value of the best child (for the side to move here)
+void MonteCarloTreeNode::updateMinimax() {
+	if (minimaxWeight == 0 || children.empty())
+		return;
+
+	double best = 0;
+	std::vector<MonteCarloTreeNode*>::iterator child;
+	for (child = children.begin(); child < children.end(); child++)
+		best = Max(best, (*child)->minimaxValue);
+
+	minimaxValue = 1 - best;
+}
+
 // Returns the move sequence leading from the root position to the position of the current node
 std::vector<Move> MonteCarloTreeNode::movesFromRoot() {
 	std::vector<Move> moves;
@@ -73,6 +203,12 @@ bool blackWins(double value) {
 	return (value <= BLACK_MATES_IN_ONE + MAX_PLY);
 }
 
+// Tells whether a playout result is a mate score proving the node rather
+// than a game outcome in [0, 1]
+bool is_proven(double result) {
+	return whiteWins(result) || blackWins(result);
+}
+
 MonteCarloTreeNode * MonteCarloTreeNode::UCT_select(Position * rootPosition) {
 	MonteCarloTreeNode * cur = this;
 	MonteCarloTreeNode * chosen = this;
@@ -100,6 +236,8 @@ MonteCarloTreeNode * MonteCarloTreeNode::UCT_select(Position * rootPosition) {
 			double winningrate = ((*child)->totalValue / (*child)->visits);
 			if (Pos->side_to_move() == BLACK)
 				winningrate = 1 - winningrate;
+			if (minimaxWeight > 0)
+				winningrate = (1 - minimaxWeight) * winningrate + minimaxWeight * (*child)->minimaxValue;
 			uctVal = winningrate + sqrt(2* log( (double) cur->visits)/ (*child)->visits) + 0.001 * (((int)(*child)->heuristicScore) / (*child)->visits);
 			if (uctVal > bestVal) {
 				chosen = &(**child);
@@ -140,12 +278,22 @@ MonteCarloTreeNode * MonteCarloTreeNode::UCT_expand(Position * rootPosition) {
 	}
 
 	lastLegal = mlist+children.size();
+	if (usePlayoutCache)
+		cache_prefetch(pos->key_after(lastLegal->move));
 	Value margin;
 	Value score = VALUE_ZERO; // (Value) pos->see(lastLegal->move);
 	pos->do_setup_move(lastLegal->move);
 	score -= evaluate(*pos, margin);
+	MonteCarloTreeNode * child = addChild(lastLegal->move, score);
+
+	// The evaluation does not see a finished game: the side that moved has
+	// won by a mate, a stalemate or a draw by rule is worth 0.5 to both sides
+	if (!has_legal_move(*pos))
+		child->minimaxValue = pos->in_check() ? 1 : 0.5;
+	else if (pos->is_really_draw())
+		child->minimaxValue = 0.5;
 	delete pos;
-	return addChild(lastLegal->move, score);
+	return child;
 }
 
 bool stmHasDecisiveMove(Position * pos, MoveStack * mlist, MoveStack * last) {
@@ -166,13 +314,52 @@ bool stmHasDecisiveMove(Position * pos, MoveStack * mlist, MoveStack * last) {
 	return false;
 }
 
+// Returns the playout result (from white's point of view) of a position whose
+// material configuration is known to the endgame module, or -1 if the playout
+// has to go on. A specialized evaluation function gives an exact result for
+// won or drawn endings and an estimate otherwise, while a zero scale factor
+// for the side ahead in material means a known draw. The endgame functions
+// do not test for stalemate, the caller has to rule it out first.
+double endgameResult(Position * pos) {
+	MaterialInfo * mi = Threads[pos->thread()].materialTable.get_material_info(*pos);
+
+	if (mi->specialized_eval_exists()) {
+		Value v = mi->evaluate(*pos);
+		if (pos->side_to_move() == BLACK)
+			v = -v;
+
+		if (v == VALUE_DRAW)
+			return 0.5;
+		if (v >= VALUE_KNOWN_WIN)
+			return 1;
+		if (v <= -VALUE_KNOWN_WIN)
+			return 0;
+		return win_probability(v);
+	}
+
+	Value w = pos->non_pawn_material(WHITE) + pos->piece_count(WHITE, PAWN) * PawnValueMidgame;
+	Value b = pos->non_pawn_material(BLACK) + pos->piece_count(BLACK, PAWN) * PawnValueMidgame;
+
+	// With equal material both sides have to be unable to win
+	if (   (w >= b && mi->scale_factor(*pos, WHITE) != SCALE_FACTOR_ZERO)
+		|| (w <= b && mi->scale_factor(*pos, BLACK) != SCALE_FACTOR_ZERO))
+		return -1;
+
+	return 0.5;
+}
+
 int pickMoveBySee(MoveStack * mlist, MoveStack * last, Position * pos) {
 	int i=0;
 	int index=-1;
 	int maxscore=0;
 	int minscore=0;
+
+	// Every move is exchanged against the same opponent pieces, so build their
+	// attack map once and let see_all() skip the moves it shows to be safe
+	pos->attacked_by(opposite_color(pos->side_to_move()));
+	pos->see_all(mlist, last);
+
 	for (MoveStack* cur = mlist; cur != last; cur++) {
-		cur->score = pos->see(cur->move);
 		if (cur->score > maxscore) {
 			maxscore = cur->score;
 			index=i;
@@ -184,23 +371,116 @@ int pickMoveBySee(MoveStack * mlist, MoveStack * last, Position * pos) {
 	}
 
 	if (index==-1)
-		index = rk.rand<unsigned int>() % (last-mlist);
+		index = rk[pos->thread()].rand<unsigned int>() % (last-mlist);
 	return index;
 }
 
 double MonteCarloTreeNode::simulate(double sim, Position * rootPosition) {
 	//simcounter = simcounter + 0.001;
 	simcounter = exp(simcounter - 1 + 0.001);
+	return playout(sim, rootPosition, simcounter);
+}
 
+namespace {
+
+	// A share of the playouts of a leaf, run by a single thread. The game
+	// outcomes are summed in total, a mate score proving the node is kept
+	// apart in proven (0 if none).
+	struct PlayoutJob {
+		MonteCarloTreeNode * node;
+		Position * rootPosition;
+		double sim, weight, total, proven;
+		int playouts, threadID;
+	};
+
+	void run_playouts(void * data) {
+		PlayoutJob * job = (PlayoutJob*)data;
+
+		// Each thread plays on its own copy to use its own material table and PRNG stream
+		Position root(*job->rootPosition, job->threadID);
+		double total = 0, proven = 0;
+		for (int i = 0; i < job->playouts && !proven; i++) {
+			double result = job->node->playout(job->sim, &root, job->weight);
+			if (is_proven(result))
+				proven = result;
+			else
+				total += result;
+		}
+		job->total = total;
+		job->proven = proven;
+	}
+}
+
+// Runs a batch of playouts from this node (leaf parallelism), splitting them
+// among the given number of threads, and returns the sum of their results,
+// or the mate score of a playout proving the node. The shares of the other
+// threads are run by the idle search threads.
+double MonteCarloTreeNode::simulate(double sim, Position * rootPosition, int playouts, int threads) {
+	PlayoutJob jobs[MAX_THREADS];
+
+	for (int i = 0; i < playouts; i++)
+		simcounter = exp(simcounter - 1 + 0.001);
+
+	threads = Max(1, Min(Min(threads, playouts), MAX_THREADS));
+	for (int i = 0; i < threads; i++) {
+		jobs[i].node = this;
+		jobs[i].rootPosition = rootPosition;
+		jobs[i].sim = sim;
+		jobs[i].weight = simcounter;
+		jobs[i].playouts = playouts / threads + (i < playouts % threads);
+		jobs[i].threadID = i;
+	}
+
+	// The calling thread takes the first share, idle threads take the rest
+	for (int i = 1; i < threads; i++) {
+		if (!Threads.start_task(i, run_playouts, &jobs[i])) {
+			for (int j = i; j < threads; j++)
+				jobs[0].playouts += jobs[j].playouts;
+			threads = i;
+			break;
+		}
+	}
+
+	run_playouts(&jobs[0]);
+	double total = jobs[0].total, proven = jobs[0].proven;
+
+	for (int i = 1; i < threads; i++) {
+		Threads.wait_task(i);
+		total += jobs[i].total;
+		if (!proven)
+			proven = jobs[i].proven;
+	}
+	return proven ? proven : total;
+}
+
+// Plays a game from this node to the end and returns its result. The outcome
+// is also stored in the playout cache for the first positions of the game.
+// The weight may scale an outcome past 1, it is clamped so that a batch of
+// outcomes never sums past its number of playouts.
+double MonteCarloTreeNode::playout(double sim, Position * rootPosition, double weight) {
+	Key keys[PLAYOUT_CACHE_PLIES];
+	int numKeys = 0;
+
+	double result = rollout(sim, rootPosition, weight, keys, numKeys);
+	if (!is_proven(result))
+		result = Min(result, 1.0);
+	for (int i = 0; i < numKeys; i++)
+		cache_record(keys[i], result);
+	return result;
+}
+
+double MonteCarloTreeNode::rollout(double sim, Position * rootPosition, double weight, Key * keys, int & numKeys) {
 	MoveStack mlist[MAX_MOVES];
 	MoveStack* last;
 
 	int numMoves, index;
+	double egResult, cachedResult;
 	Position * pos = getTreeNodePosition(this, rootPosition);
+	RKISS & rng = rk[pos->thread()];
 
 	if (pos->is_draw()) {
 		delete pos;
-		return simcounter*0.5;
+		return weight*0.5;
 	}
 
 	if (pos->is_mate()) {
@@ -214,30 +494,40 @@ double MonteCarloTreeNode::simulate(double sim, Position * rootPosition) {
 		}
 	}
 
-	last = generate<MV_LEGAL>(*pos, mlist);
-	numMoves = last - mlist;
-
-	// PRNG sequence should be non deterministic
-	for (int i = abs(get_system_time() % 50); i > 0; i--)
-		rk.rand<unsigned>();
-
 	while (!pos->is_draw() && !pos->is_mate()) {
 
 		// Generate all legal moves
 		last = generate<MV_LEGAL>(*pos, mlist);
 		numMoves = last - mlist;
 
-		// stalemate positions are not recognized by pos->is_draw()
+		// stalemate positions are not recognized by pos->is_draw(), nor by
+		// the endgame module, so check them first
 		if (numMoves == 0) {
 			delete pos;
-			return 0.5; // simcounter*0.5;
+			return 0.5; // weight*0.5;
+		}
+
+		// Stop as soon as the endgame module knows the result
+		if ((egResult = endgameResult(pos)) >= 0) {
+			delete pos;
+			return egResult;
+		}
+
+		// Early in the playout, finish with a result sampled from the earlier
+		// playouts through this position if there are enough of them.
+		if (usePlayoutCache && numKeys < PLAYOUT_CACHE_PLIES) {
+			if ((cachedResult = cache_sample(pos->get_key(), rng)) >= 0) {
+				delete pos;
+				return cachedResult;
+			}
+			keys[numKeys++] = pos->get_key();
 		}
 
 		// Check for decisive moves
 		if (stmHasDecisiveMove(pos, mlist, last)) {
 			if (pos->side_to_move() == WHITE) {
 				delete pos;
-				return 1; // simcounter*1;
+				return 1; // weight*1;
 			}
 			else {
 				delete pos;
@@ -247,25 +537,26 @@ double MonteCarloTreeNode::simulate(double sim, Position * rootPosition) {
 
 		StateInfo st;
 
-		if (rk.rand<unsigned int>() % 10 < 6) {
+		if (rng.rand<unsigned int>() % 10 < 6)
 			index = pickMoveBySee(mlist, last, pos);
-			pos->do_move(mlist[index].move, st);
-		}
-		else {
-			index = rk.rand<unsigned int>() % numMoves;
-			pos->do_move(mlist[index].move, st);
-		}
+		else
+			index = rng.rand<unsigned int>() % numMoves;
+
+		if (usePlayoutCache && numKeys < PLAYOUT_CACHE_PLIES)
+			cache_prefetch(pos->key_after(mlist[index].move));
+
+		pos->do_move(mlist[index].move, st);
 
 		// Check for trap (if this was in the old trap list, backpropagate it
 		// with probability p = similarity or 0.5)
 		if (pos->is_trap()) {
 			//if (stmHasDecisiveMove(pos, mlist, last)) {
 			if (trapcheck(mlist[index].move)) {
-				if (rk.rand<unsigned int>() % 100 < 100 * sim) {
-					//if (rk.rand<unsigned int>() % 10 < 6) {
+				if (rng.rand<unsigned int>() % 100 < 100 * sim) {
+					//if (rng.rand<unsigned int>() % 10 < 6) {
 					if (pos->side_to_move() == WHITE) {
 						delete pos;
-						return 1; // simcounter*1;
+						return 1; // weight*1;
 					} else {
 						delete pos;
 						return 0;
@@ -274,7 +565,7 @@ double MonteCarloTreeNode::simulate(double sim, Position * rootPosition) {
 			}
 			// Else pick another move randomly (don't do this as it avoids failure)
 			//pos->undo_move(mlist[index].move);
-			//index = rk.rand<unsigned int>() % numMoves;
+			//index = rng.rand<unsigned int>() % numMoves;
 			//pos->do_move(mlist[index].move, st);
 		}
 
@@ -289,25 +580,27 @@ double MonteCarloTreeNode::simulate(double sim, Position * rootPosition) {
 			return 0;
 		}
 		delete pos;
-		return simcounter*1;
+		return weight*1;
 	}
 	delete pos;
-	return simcounter*0.5;
+	return weight*0.5;
 }
 
-void MonteCarloTreeNode::normalUpdate(double value) {
+void MonteCarloTreeNode::normalUpdate(double value, int playouts) {
 	if (!whiteWins(totalValue) && !blackWins(totalValue)) {
 		totalValue += value;
 	}
 
-	visits++;
+	visits += playouts;
+	updateMinimax();
 
 	if (parent)
-		parent->normalUpdate(value);
+		parent->normalUpdate(value, playouts);
 }
 
 void MonteCarloTreeNode::updateKnownWin(double value, bool whiteToMove) {
 	visits++;
+	updateMinimax();
 
 	if (! ( (whiteToMove && whiteWins(value) && totalValue > value)
 			|| (!whiteToMove && blackWins(value) && totalValue < value)))
@@ -365,8 +658,10 @@ void MonteCarloTreeNode::updateKnownWin(double value, bool whiteToMove) {
 	}
 }
 
-void MonteCarloTreeNode::update(double value, Position * root) {
-	if (value < 0 || value > 1) {
+// Backs up the summed result of a number of playouts from this node, or the
+// mate score of a playout proving it
+void MonteCarloTreeNode::update(double value, Position * root, int playouts) {
+	if (is_proven(value)) {
 		bool whiteToMove;
 		if (movesFromRoot().size() % 2 == 0)
 			whiteToMove = (root->side_to_move() == WHITE) ? true : false;
@@ -374,11 +669,15 @@ void MonteCarloTreeNode::update(double value, Position * root) {
 			whiteToMove = (root->side_to_move() == WHITE) ? false : true;
 		updateKnownWin(value, whiteToMove);
 	} else {
-		this->normalUpdate(value);
+		this->normalUpdate(value, playouts);
 	}
 }
 
+// Returns the most visited child, or NULL if the node has not been expanded
 MonteCarloTreeNode * MonteCarloTreeNode::bestChild() {
+	if (children.empty())
+		return NULL;
+
 	int maxVisits = 0;
 	MonteCarloTreeNode * curBestChild = children[0];
 	for (unsigned int i = 0; i < children.size(); i++) {
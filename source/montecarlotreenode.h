@@ -15,6 +15,10 @@
 const int MAX_PLY = 255;
 const int BLACK_MATES_IN_ONE = -INT_MAX;
 const int WHITE_MATES_IN_ONE = INT_MAX;
+const double EVAL_WIN_SCALE = 2 * PawnValueEndgame;  // evaluation to win probability scale
+const int PLAYOUT_CACHE_SIZE = 1 << 20;     // number of entries of the playout outcome cache
+const int PLAYOUT_CACHE_PLIES = 4;          // leading playout plies whose outcomes are cached
+const int PLAYOUT_CACHE_MIN_SAMPLES = 16;   // cached outcomes needed before a playout is cut short
 
 class MonteCarloTreeNode {
 
@@ -24,8 +28,10 @@ public:
 	MonteCarloTreeNode * UCT_select(Position * rootPosition);
 	MonteCarloTreeNode * UCT_expand(Position * rootPosition);
 	double simulate(double sim, Position * rootPosition);
-	void update(double value, Position * root);
-	void normalUpdate(double value);
+	double simulate(double sim, Position * rootPosition, int playouts, int threads);
+	double playout(double sim, Position * rootPosition, double weight);
+	void update(double value, Position * root, int playouts = 1);
+	void normalUpdate(double value, int playouts = 1);
 	std::vector<Move> movesFromRoot();
 	void printMultiPv(int depth, int iterations, int searchTime, bool whiteToMove, int UCIMultiPV);
 	std::string pv_info_to_uci(int depth, unsigned long int iterations, int searchTime, bool whiteToMove, int multipv);
@@ -38,11 +44,20 @@ public:
 private:
 	void updateKnownWin(double value, bool whiteToMove);
 	MonteCarloTreeNode * addChild(Move move, Value score);
+	double rollout(double sim, Position * rootPosition, double weight, Key * keys, int & numKeys);
+	void updateMinimax();
 	Value heuristicScore;
+	double minimaxValue; // heuristic win probability for the side that played lastMove, backed up by minimax
 	size_t maxMoves;
 	double totalValue;
 	MonteCarloTreeNode * parent;
 	std::vector<MonteCarloTreeNode *> children;
 };
 
+void seed_playouts(uint64_t seed);
+void init_playout_cache(bool enabled);
+void set_implicit_minimax(double weight);
+double win_probability(Value v);
+bool is_proven(double result);
+
 #endif /* MONTECARLO_H_ */
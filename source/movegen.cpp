@@ -42,6 +42,9 @@ namespace {
   template<Color, MoveType>
   MoveStack* generate_pawn_moves(const Position&, MoveStack*, Bitboard, Square);
 
+  template<Color, bool HasPopCnt>
+  int count_pawn_moves(const Position&, Bitboard, Bitboard, Square);
+
   template<PieceType Pt>
   inline MoveStack* generate_discovered_checks(const Position& pos, MoveStack* mlist, Square from) {
 
@@ -135,6 +138,45 @@ namespace {
     return mlist;
   }
 
+  // Version used by the legal move generator, a pinned piece can only move
+  // along the line through our king and itself.
+  template<PieceType Pt>
+  FORCE_INLINE MoveStack* generate_legal_piece_moves(const Position& pos, MoveStack* mlist, Color us,
+                                                     Bitboard target, Bitboard pinned, Square ksq) {
+    Bitboard b;
+    Square from, to;
+    const Square* ptr = pos.piece_list_begin(us, Pt);
+
+    while ((from = *ptr++) != SQ_NONE)
+    {
+        b = pos.attacks_from<Pt>(from) & target;
+
+        if (pinned && bit_is_set(pinned, from))
+        {
+            while (b)
+            {
+                to = pop_1st_bit(&b);
+                if (squares_aligned(ksq, from, to))
+                    (*mlist++).move = make_move(from, to);
+            }
+            continue;
+        }
+        SERIALIZE_MOVES(b);
+    }
+    return mlist;
+  }
+
+  // square_is_attacked() tests whether the given square is attacked by the
+  // given color when the squares of 'occ' are the occupied ones.
+  inline bool square_is_attacked(const Position& pos, Square s, Color them, Bitboard occ) {
+
+    return   (pos.attacks_from<PAWN>(s, opposite_color(them)) & pos.pieces(PAWN, them))
+          || (pos.attacks_from<KNIGHT>(s) & pos.pieces(KNIGHT, them))
+          || (pos.attacks_from<KING>(s)   & pos.pieces(KING, them))
+          || (rook_attacks_bb(s, occ)     & pos.pieces(ROOK, QUEEN, them))
+          || (bishop_attacks_bb(s, occ)   & pos.pieces(BISHOP, QUEEN, them));
+  }
+
 }
 
 
@@ -314,25 +356,188 @@ MoveStack* generate<MV_PSEUDO_LEGAL>(const Position& pos, MoveStack* mlist) {
                         : generate<MV_NON_EVASION>(pos, mlist);
 }
 
+/// The legal moves are generated directly instead of filtering the pseudo-legal
+/// ones. Checkers and pinned pieces are computed once, the king destinations
+/// are tested against the opponent attacks with the king lifted off the board,
+/// the other pieces are restricted to the blocking squares when in check and
+/// to the pin line when pinned. Only the moves of pinned pawns and the en
+/// passant captures are still tested one by one.
 template<>
 MoveStack* generate<MV_LEGAL>(const Position& pos, MoveStack* mlist) {
 
   assert(pos.is_ok());
 
-  MoveStack *last, *cur = mlist;
-  Bitboard pinned = pos.pinned_pieces(pos.side_to_move());
+  Bitboard b, target;
+  Square from, to;
+  Color us = pos.side_to_move();
+  Color them = opposite_color(us);
+  Square ksq = pos.king_square(us);
+  Bitboard checkers = pos.checkers();
+  Bitboard pinned = pos.pinned_pieces(us);
+  Bitboard occ = pos.occupied_squares() ^ SetMaskBB[ksq];
+
+  assert(pos.piece_on(ksq) == make_piece(us, KING));
+
+  // King moves, the king is removed from the occupied squares so that
+  // it can not step back along the line of a checking slider.
+  b = pos.attacks_from<KING>(ksq) & ~pos.pieces_of_color(us);
+  from = ksq;
+  while (b)
+  {
+      to = pop_1st_bit(&b);
+      if (!square_is_attacked(pos, to, them, occ))
+          (*mlist++).move = make_move(from, to);
+  }
 
-  last = generate<MV_PSEUDO_LEGAL>(pos, mlist);
+  // In double check only the king can move
+  if (checkers & (checkers - 1))
+      return mlist;
 
-  // Remove illegal moves from the list
-  while (cur != last)
-      if (!pos.pl_move_is_legal(cur->move, pinned))
-          cur->move = (--last)->move;
-      else
-          cur++;
+  // Pawn moves, pinned pawns and en passant captures are checked apart
+  MoveStack *cur = mlist, *last;
 
-  return last;
+  if (checkers)
+  {
+      target = squares_between(first_1(checkers), ksq) | checkers;
+      last = generate_piece_moves<PAWN, MV_EVASION>(pos, mlist, us, target);
+  }
+  else
+  {
+      target = pos.pieces_of_color(them) | pos.empty_squares();
+      last = generate_piece_moves<PAWN, MV_CAPTURE>(pos, mlist, us, pos.pieces_of_color(them));
+      last = generate_piece_moves<PAWN, MV_NON_CAPTURE>(pos, last, us, pos.empty_squares());
+  }
+
+  if ((pinned & pos.pieces(PAWN, us)) || pos.ep_square() != SQ_NONE)
+  {
+      while (cur != last)
+          if (   (bit_is_set(pinned, move_from(cur->move)) || move_is_ep(cur->move))
+              && !pos.pl_move_is_legal(cur->move, pinned))
+              cur->move = (--last)->move;
+          else
+              cur++;
+  }
+  mlist = last;
+
+  mlist = generate_legal_piece_moves<KNIGHT>(pos, mlist, us, target, pinned, ksq);
+  mlist = generate_legal_piece_moves<BISHOP>(pos, mlist, us, target, pinned, ksq);
+  mlist = generate_legal_piece_moves<ROOK>(pos, mlist, us, target, pinned, ksq);
+  mlist = generate_legal_piece_moves<QUEEN>(pos, mlist, us, target, pinned, ksq);
+
+  if (!checkers)
+  {
+      if (pos.can_castle_kingside(us))
+          mlist = generate_castle_moves<KING_SIDE>(pos, mlist, us);
+
+      if (pos.can_castle_queenside(us))
+          mlist = generate_castle_moves<QUEEN_SIDE>(pos, mlist, us);
+  }
+
+  return mlist;
+}
+
+
+/// count_legal() returns the number of legal moves in the current position
+/// without writing them in a list, the legal destinations of each piece are
+/// popcounted. has_legal_move() stops at the first legal move found.
+
+namespace {
+
+  template<bool AnyMove, bool HasPopCnt>
+  int legal_moves(const Position& pos) {
+
+    assert(pos.is_ok());
+
+    const BitCountType Full = HasPopCnt ? CNT_POPCNT : CpuIs64Bit ? CNT64 : CNT32;
+
+    Bitboard b, target;
+    Square from, to;
+    Color us = pos.side_to_move();
+    Color them = opposite_color(us);
+    Square ksq = pos.king_square(us);
+    Bitboard checkers = pos.checkers();
+    Bitboard pinned = pos.pinned_pieces(us);
+    Bitboard occ = pos.occupied_squares() ^ SetMaskBB[ksq];
+    int cnt = 0;
+
+    // King moves
+    b = pos.attacks_from<KING>(ksq) & ~pos.pieces_of_color(us);
+    while (b)
+        if (!square_is_attacked(pos, pop_1st_bit(&b), them, occ))
+        {
+            cnt++;
+            if (AnyMove)
+                return cnt;
+        }
+
+    if (checkers & (checkers - 1))
+        return cnt;
+
+    target = checkers ? squares_between(first_1(checkers), ksq) | checkers
+                      : ~pos.pieces_of_color(us);
+
+    // Pawn moves
+    cnt += (us == WHITE ? count_pawn_moves<WHITE, HasPopCnt>(pos, target, pinned, ksq)
+                        : count_pawn_moves<BLACK, HasPopCnt>(pos, target, pinned, ksq));
+    if (AnyMove && cnt)
+        return cnt;
+
+    // Knight, bishop, rook and queen moves, a pinned knight can never move
+    for (PieceType pt = KNIGHT; pt <= QUEEN; pt++)
+    {
+        const Square* ptr = pos.piece_list_begin(us, pt);
+
+        while ((from = *ptr++) != SQ_NONE)
+        {
+            if (pt == KNIGHT && bit_is_set(pinned, from))
+                continue;
+
+            b = pos.attacks_from(make_piece(us, pt), from) & target;
+
+            if (bit_is_set(pinned, from))
+            {
+                while (b)
+                    if (squares_aligned(ksq, from, to = pop_1st_bit(&b)))
+                        cnt++;
+            }
+            else
+                cnt += count_1s<Full>(b);
+
+            if (AnyMove && cnt)
+                return cnt;
+        }
+    }
+
+    // Castling, the rare legal castle moves are generated in a scratch list
+    if (!checkers && pos.can_castle(us))
+    {
+        MoveStack mlist[2], *last = mlist;
+
+        if (pos.can_castle_kingside(us))
+            last = generate_castle_moves<KING_SIDE>(pos, last, us);
+
+        if (pos.can_castle_queenside(us))
+            last = generate_castle_moves<QUEEN_SIDE>(pos, last, us);
+
+        cnt += int(last - mlist);
+    }
+    return cnt;
+  }
+
+} // namespace
+
+int count_legal(const Position& pos) {
+
+  return CpuHasPOPCNT ? legal_moves<false, true>(pos)
+                      : legal_moves<false, false>(pos);
 }
+
+bool has_legal_move(const Position& pos) {
+
+  return (CpuHasPOPCNT ? legal_moves<true, true>(pos)
+                       : legal_moves<true, false>(pos)) > 0;
+}
+
 /*
 // NEW
 template<>
@@ -552,6 +757,64 @@ namespace {
     return mlist;
   }
 
+  template<Color Us, bool HasPopCnt>
+  int count_pawn_moves(const Position& pos, Bitboard target, Bitboard pinned, Square ksq) {
+
+    // Calculate our parametrized parameters at compile time, named
+    // according to the point of view of white side.
+    const BitCountType Full = HasPopCnt ? CNT_POPCNT : CpuIs64Bit ? CNT64 : CNT32;
+    const Color    Them      = (Us == WHITE ? BLACK    : WHITE);
+    const Bitboard TRank8BB  = (Us == WHITE ? Rank8BB  : Rank1BB);
+    const Bitboard TRank3BB  = (Us == WHITE ? Rank3BB  : Rank6BB);
+    const Square   TDELTA_N  = (Us == WHITE ? DELTA_N  : DELTA_S);
+    const Square   TDELTA_NE = (Us == WHITE ? DELTA_NE : DELTA_SE);
+    const Square   TDELTA_NW = (Us == WHITE ? DELTA_NW : DELTA_SW);
+
+    Bitboard pawns = pos.pieces(PAWN, Us);
+    Bitboard emptySquares = pos.empty_squares();
+    Bitboard enemyPieces = pos.pieces_of_color(Them) & target;
+    Bitboard b1, b2, b3, b4;
+    Square from, to;
+    int cnt = 0;
+
+    // Pawns which are not pinned, in bulk. A promotion counts for four moves.
+    b1 = move_pawns<TDELTA_N>(pawns & ~pinned) & emptySquares;
+    b2 = move_pawns<TDELTA_N>(b1 & TRank3BB) & emptySquares & target;
+    b1 &= target;
+    b3 = move_pawns<TDELTA_NE>(pawns & ~pinned) & enemyPieces & ~FileABB;
+    b4 = move_pawns<TDELTA_NW>(pawns & ~pinned) & enemyPieces & ~FileHBB;
+
+    cnt += count_1s<Full>(b1 & ~TRank8BB) + count_1s<Full>(b2)
+         + count_1s<Full>(b3 & ~TRank8BB) + count_1s<Full>(b4 & ~TRank8BB)
+         + 4 * (count_1s<Full>(b1 & TRank8BB) + count_1s<Full>(b3 & TRank8BB) + count_1s<Full>(b4 & TRank8BB));
+
+    // Pinned pawns one by one, along the line of the pin only
+    b1 = pawns & pinned;
+    while (b1)
+    {
+        from = pop_1st_bit(&b1);
+        b3 = move_pawns<TDELTA_N>(SetMaskBB[from]) & emptySquares;
+        b2 = (b3 | move_pawns<TDELTA_N>(b3 & TRank3BB)) & emptySquares & target;
+        b2 |= pos.attacks_from<PAWN>(from, Us) & enemyPieces;
+
+        while (b2)
+            if (squares_aligned(ksq, from, to = pop_1st_bit(&b2)))
+                cnt += bit_is_set(TRank8BB, to) ? 4 : 1;
+    }
+
+    // En passant captures, as in generate_pawn_moves() an en passant capture
+    // can be an evasion only if the checking piece is the double pushed pawn.
+    to = pos.ep_square();
+    if (to != SQ_NONE && (!pos.in_check() || bit_is_set(target, to - TDELTA_N)))
+    {
+        b1 = pawns & pos.attacks_from<PAWN>(to, Them);
+        while (b1)
+            if (pos.pl_move_is_legal(make_ep_move(pop_1st_bit(&b1), to), pinned))
+                cnt++;
+    }
+    return cnt;
+  }
+
   template<CastlingSide Side>
   MoveStack* generate_castle_moves(const Position& pos, MoveStack* mlist, Color us) {
 
@@ -41,6 +41,9 @@ MoveStack* generate(const Position& pos, MoveStack* mlist);
 template<MoveType>
 MoveStack* generate(Position* pos, MoveStack* mlist);
 
+int count_legal(const Position& pos);
+bool has_legal_move(const Position& pos);
+
 //template<MoveType>
 //MoveStack* generate(Position& pos, MoveStack* mlist);
 
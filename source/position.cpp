@@ -129,10 +129,15 @@ CheckInfo::CheckInfo(const Position& pos) {
 /// Position c'tors. Here we always create a copy of the original position
 /// or the FEN string, we want the new born Position object do not depend
 /// on any external data so we detach state pointer from the source one.
+/// The game history is shared with the source until one of them writes it.
 
 Position::Position(const Position& pos, int th) {
 
   memcpy(this, &pos, sizeof(Position));
+
+  if (history)
+      history->refs++;
+
   detach(); // Always detach() in copy c'tor to avoid surprises
   threadID = th;
   nodes = 0;
@@ -140,23 +145,125 @@ Position::Position(const Position& pos, int th) {
 
 Position::Position(const string& fen, bool isChess960, int th) {
 
+  history = NULL;
   from_fen(fen, isChess960);
   threadID = th;
 }
 
+Position::~Position() {
+
+  release_history();
+}
+
+
+/// Position::release_history() drops the reference of the position to its
+/// game history and deletes the history when it was the last one.
+
+void Position::release_history() {
+
+  if (history && --history->refs == 0)
+      delete history;
+
+  history = NULL;
+}
+
 
 /// Position::detach() copies the content of the current state and castling
 /// masks inside the position itself. This is needed when the st pointee could
 /// become stale, as example because the caller is about to going out of scope.
+/// The keys of the states left behind are moved to the game history first,
+/// as far back as a repetition can still be detected.
 
 void Position::detach() {
 
+  if (st->gamePly == 0)
+      release_history();
+  else
+  {
+      int ply = st->gamePly;
+      int last = ply - Min(st->rule50, st->pliesFromNull);
+      const StateInfo* stp = st;
+
+      // Count the states of the chain which still matter for repetitions
+      while (ply > last && stp->previous)
+      {
+          stp = stp->previous;
+          ply--;
+      }
+
+      if (ply < st->gamePly && !(history && history->refs > 1 && append_shared_history(ply)))
+      {
+          // Copy the history before writing it if another position shares it
+          if (!history || history->refs > 1)
+          {
+              KeyHistory* h = new KeyHistory();
+              if (history)
+                  h->keys.assign(history->keys.begin(), history->keys.begin() + Min(ply, history->size));
+
+              release_history();
+              history = h;
+          }
+
+          // Leave some room to append in place once the history is shared
+          history->size = st->gamePly;
+          if (int(history->keys.size()) < history->size)
+              history->keys.resize(history->size + 2 * PLY_MAX);
+
+          stp = st;
+          for (int i = st->gamePly - 1; i >= ply; i--)
+          {
+              stp = stp->previous;
+              history->keys[i] = stp->key;
+          }
+      }
+  }
+
   startState = *st;
   st = &startState;
   st->previous = NULL; // as a safe guard
 }
 
 
+/// Position::append_shared_history() writes the keys of the states of the
+/// chain from game ply 'ply' on into a history shared with other positions.
+/// Keys already in the history must be the same as ours, those past its end
+/// are appended if the buffer has room. Returns false when the histories
+/// split, then the caller has to take a private copy.
+
+bool Position::append_shared_history(int ply) {
+
+  bool split = false;
+  const StateInfo* stp;
+  int i;
+
+  lock_grab(&history->lock);
+
+  int end = Min(history->size, st->gamePly);
+
+  if (st->gamePly > int(history->keys.size()))
+      split = true;
+
+  for (stp = st, i = st->gamePly - 1; !split && i >= ply; i--)
+  {
+      stp = stp->previous;
+      split = (i < end && history->keys[i] != stp->key);
+  }
+
+  if (!split && st->gamePly > history->size)
+  {
+      for (stp = st, i = st->gamePly - 1; i >= Max(ply, history->size); i--)
+      {
+          stp = stp->previous;
+          history->keys[i] = stp->key;
+      }
+      history->size = st->gamePly;
+  }
+
+  lock_release(&history->lock);
+  return !split;
+}
+
+
 /// Position::from_fen() initializes the position object with the given FEN
 /// string. This function is not very robust - make sure that input FENs are
 /// correct (this is assumed to be the responsibility of the GUI).
@@ -202,6 +309,9 @@ void Position::from_fen(const string& fen, bool isChess960) {
   {
       if (pieceLetters.find(token) != pieceLetters.end())
       {
+          if (!square_is_ok(sq))
+              goto incorrect_fen;
+
           put_piece(pieceLetters[token], sq);
           sq++;
       }
@@ -213,6 +323,10 @@ void Position::from_fen(const string& fen, bool isChess960) {
           goto incorrect_fen;
   }
 
+  // Each side needs exactly one king, the attack and check code assume it
+  if (piece_count(WHITE, KING) != 1 || piece_count(BLACK, KING) != 1)
+      goto incorrect_fen;
+
   // 2. Active color
   if (!ss.get(token) || (token != 'w' && token != 'b'))
       goto incorrect_fen;
@@ -489,6 +603,34 @@ Bitboard Position::attackers_to(Square s) const {
         | (attacks_from<KING>(s)        & pieces(KING));
 }
 
+/// Position::attacked_by() returns a bitboard of all the squares attacked
+/// by the pieces of the given color. The map is computed the first time it
+/// is asked for in the current state and then kept in the StateInfo, so that
+/// the following calls are a single lookup and undo_move() drops it for free.
+
+Bitboard Position::attacked_by(Color c) const {
+
+  if (st->attacksReady & (1 << c))
+      return st->attackedBB[c];
+
+  Bitboard b = pieces(PAWN, c);
+  Bitboard attacks = (c == WHITE ? ((b & ~FileABB) << 7) | ((b & ~FileHBB) << 9)
+                                 : ((b & ~FileABB) >> 9) | ((b & ~FileHBB) >> 7));
+
+  for (PieceType pt = KNIGHT; pt <= KING; pt++)
+  {
+      const Square* ptr = piece_list_begin(c, pt);
+      Square s;
+
+      while ((s = *ptr++) != SQ_NONE)
+          attacks |= attacks_from(make_piece(c, pt), s);
+  }
+
+  st->attackedBB[c] = attacks;
+  st->attacksReady |= 1 << c;
+  return attacks;
+}
+
 /// Position::attacks_from() computes a bitboard of all attacks
 /// of a given piece put in a given square.
 
@@ -895,7 +1037,8 @@ void Position::do_setup_move(Move m) {
   startPosPlyCounter++;
 
   // Our StateInfo newSt is about going out of scope so copy
-  // its content before it disappears.
+  // its content before it disappears. The key of the position
+  // before the move is moved to the game history on the way.
   detach();
 }
 
@@ -933,11 +1076,12 @@ void Position::do_move(Move m, StateInfo& newSt, const CheckInfo& ci, bool moveI
   memcpy(&newSt, st, sizeof(ReducedStateInfo));
 
   newSt.previous = st;
+  newSt.attacksReady = 0;
   st = &newSt;
 
-  // Save the current key to the history[] array, in order to be able to
-  // detect repetition draws.
-  history[st->gamePly++] = key;
+  // The current key stays reachable through newSt.previous, in order to
+  // be able to detect repetition draws.
+  st->gamePly++;
 
   // Update side to move
   key ^= zobSideToMove;
@@ -1278,6 +1422,65 @@ void Position::do_castle_move(Move m) {
 }
 
 
+/// Position::key_after() returns the hash key of the position after a legal
+/// move without making it. The key is updated incrementally the same way as
+/// in do_move() and do_castle_move(), covering captures, castling, en passant
+/// and promotions.
+
+Key Position::key_after(Move m) const {
+
+  assert(move_is_ok(m));
+
+  Color us = side_to_move();
+  Color them = opposite_color(us);
+  Square from = move_from(m);
+  Square to = move_to(m);
+  Key key = st->key ^ zobSideToMove;
+
+  // Reset en passant square
+  if (st->epSquare != SQ_NONE)
+      key ^= zobEp[st->epSquare];
+
+  if (move_is_castle(m))
+  {
+      // HACK: castling is encoded as "king captures friendly rook"
+      Square kto = relative_square(us, to > from ? SQ_G1 : SQ_C1);
+      Square rto = relative_square(us, to > from ? SQ_F1 : SQ_D1);
+
+      return  key
+            ^ zobrist[us][KING][from] ^ zobrist[us][KING][kto]
+            ^ zobrist[us][ROOK][to] ^ zobrist[us][ROOK][rto]
+            ^ zobCastle[st->castleRights]
+            ^ zobCastle[st->castleRights & castleRightsMask[from]];
+  }
+
+  PieceType pt = type_of_piece_on(from);
+
+  // Remove the captured piece
+  if (move_is_ep(m))
+      key ^= zobrist[them][PAWN][to + (us == WHITE ? DELTA_S : DELTA_N)];
+  else if (square_is_occupied(to))
+      key ^= zobrist[them][type_of_piece_on(to)][to];
+
+  // Move the piece, a promoted pawn lands as the promotion piece
+  key ^= zobrist[us][pt][from];
+  key ^= zobrist[us][move_is_promotion(m) ? move_promotion_piece(m) : pt][to];
+
+  // Update castle rights
+  int cr = st->castleRights & castleRightsMask[from] & castleRightsMask[to];
+  if (cr != st->castleRights)
+      key ^= zobCastle[st->castleRights] ^ zobCastle[cr];
+
+  // Set en passant square, only if moved pawn can be captured
+  if (   pt == PAWN
+      && (to ^ from) == 16
+      && (attacks_from<PAWN>(from + (us == WHITE ? DELTA_N : DELTA_S), us) & pieces(PAWN, them)))
+      key ^= zobEp[Square((int(from) + int(to)) / 2)];
+
+  return key;
+}
+
+
 /// Position::undo_move() unmakes a move. When it returns, the position should
 /// be restored to exactly the same state as before the move was made.
 
@@ -1467,9 +1670,9 @@ void Position::do_null_move(StateInfo& backupSt) {
   backupSt.pliesFromNull = st->pliesFromNull;
   st->previous = &backupSt;
 
-  // Save the current key to the history[] array, in order to be able to
-  // detect repetition draws.
-  history[st->gamePly++] = st->key;
+  // No repetition is looked for across a null move, so the current key
+  // does not need to be saved.
+  st->gamePly++;
 
   // Update the necessary information
   if (st->epSquare != SQ_NONE)
@@ -1538,9 +1741,8 @@ int Position::see_sign(Move m) const {
 
 int Position::see(Square from, Square to) const {
 
-  Bitboard occupied, attackers, stmAttackers, b;
-  int swapList[32], slIndex = 1;
-  PieceType capturedType, pt;
+  Bitboard occupied, attackers;
+  PieceType capturedType;
   Color stm;
 
   assert(square_is_ok(from));
@@ -1552,6 +1754,16 @@ int Position::see(Square from, Square to) const {
   if (capturedType == KING)
       return seeValues[capturedType];
 
+  // When the attack map of the opponent is at hand a move that neither
+  // goes to nor leaves from a square he attacks cannot be recaptured, not
+  // even by an X-ray attacker behind the moving piece. En passant captures
+  // also uncover the square of the captured pawn, so they take the long way.
+  stm = opposite_color(color_of_piece_on(from));
+  if (   (st->attacksReady & (1 << stm))
+      && !(st->attackedBB[stm] & (SetMaskBB[from] | SetMaskBB[to]))
+      && to != st->epSquare)
+      return seeValues[capturedType];
+
   occupied = occupied_squares();
 
   // Handle en passant moves
@@ -1577,8 +1789,71 @@ int Position::see(Square from, Square to) const {
              | (attacks_from<PAWN>(to, WHITE)  & pieces(PAWN, BLACK))
              | (attacks_from<PAWN>(to, BLACK)  & pieces(PAWN, WHITE));
 
+  return see_swap(from, to, occupied, attackers, capturedType);
+}
+
+
+/// Position::see_all() evaluates see() for all the moves of a list and stores
+/// the results in their score fields. The attackers to a destination square
+/// are computed once and shared by all the moves to that square, only the
+/// X-ray attacker possibly uncovered by each moving piece is looked up again.
+
+void Position::see_all(MoveStack* first, MoveStack* last) const {
+
+  Bitboard attackers[64], found = EmptyBoardBB;
+  Bitboard occupied = occupied_squares();
+
+  for (MoveStack* cur = first; cur != last; cur++)
+  {
+      Square from = move_from(cur->move);
+      Square to = move_to(cur->move);
+      PieceType capturedType = type_of_piece_on(to);
+      Color them = opposite_color(color_of_piece_on(from));
+
+      // King captures, en passant captures and the moves the attack map
+      // shows to be safe are answered by see() without any swap list.
+      if (   capturedType == KING
+          || to == st->epSquare
+          || (   (st->attacksReady & (1 << them))
+              && !(st->attackedBB[them] & (SetMaskBB[from] | SetMaskBB[to]))))
+      {
+          cur->score = see(from, to);
+          continue;
+      }
+
+      if (!bit_is_set(found, to))
+      {
+          attackers[to] = attackers_to(to);
+          set_bit(&found, to);
+      }
+
+      // Removing the moving piece can only uncover a slider on the line
+      // from the destination square through the origin square.
+      Bitboard b = attackers[to];
+      Bitboard occ = occupied ^ SetMaskBB[from];
+
+      if (bit_is_set(RookPseudoAttacks[to], from))
+          b |= rook_attacks_bb(to, occ) & pieces(ROOK, QUEEN);
+      else if (bit_is_set(BishopPseudoAttacks[to], from))
+          b |= bishop_attacks_bb(to, occ) & pieces(BISHOP, QUEEN);
+
+      cur->score = see_swap(from, to, occ, b, capturedType);
+  }
+}
+
+
+/// Position::see_swap() is the second half of see(): given the attackers to
+/// the destination square, with the moving piece already removed from the
+/// occupied squares, it plays the exchange sequence on that square.
+
+int Position::see_swap(Square from, Square to, Bitboard occupied, Bitboard attackers, PieceType capturedType) const {
+
+  Bitboard stmAttackers, b;
+  int swapList[32], slIndex = 1;
+  PieceType pt;
+  Color stm = opposite_color(color_of_piece_on(from));
+
   // If the opponent has no attackers we are finished
-  stm = opposite_color(color_of_piece_on(from));
   stmAttackers = attackers & pieces_of_color(stm);
   if (!stmAttackers)
       return seeValues[capturedType];
@@ -1642,6 +1917,7 @@ int Position::see(Square from, Square to) const {
 
 void Position::clear() {
 
+  release_history();
   st = &startState;
   memset(st, 0, sizeof(StateInfo));
   st->epSquare = SQ_NONE;
@@ -1803,10 +2079,8 @@ bool Position::is_really_draw() const {
 	      return true;
 
 	  // Draw by repetition?
-	  int numRepetitions = 0;
-	  for (int i = 4, e = Min(Min(st->gamePly, st->rule50), st->pliesFromNull); i <= e; i += 2)
-	      if (history[st->gamePly - i] == st->key && ++numRepetitions == 2)
-	          return true;
+	  if (repetitions(2) == 2)
+	      return true;
 
 	  return false;
 }
@@ -1827,21 +2101,48 @@ bool Position::is_draw() const {
       return true;
 
   // Draw by repetition?
-  for (int i = 4, e = Min(Min(st->gamePly, st->rule50), st->pliesFromNull); i <= e; i += 2)
-      if (history[st->gamePly - i] == st->key)
-          return true;
+  if (repetitions(1))
+      return true;
 
   return false;
 }
 
 
+/// Position::repetitions() counts, up to maxCount, the earlier occurrences of
+/// the current position since the last non-reversible move or null move. The
+/// states played since the last detach() are walked through the StateInfo
+/// chain, the older ones are looked up in the game history.
+
+int Position::repetitions(int maxCount) const {
+
+  int count = 0;
+  const StateInfo* stp = st;
+
+  for (int i = 2, e = Min(Min(st->gamePly, st->rule50), st->pliesFromNull); i <= e; i += 2)
+  {
+      Key key;
+
+      if (stp->previous && stp->previous->previous)
+      {
+          stp = stp->previous->previous;
+          key = stp->key;
+      }
+      else
+          key = history->keys[st->gamePly - i];
+
+      if (i >= 4 && key == st->key && ++count == maxCount)
+          break;
+  }
+  return count;
+}
+
+
 /// Position::is_mate() returns true or false depending on whether the
 /// side to move is checkmated.
 
 bool Position::is_mate() const {
 
-  MoveStack moves[MAX_MOVES];
-  return in_check() && generate<MV_LEGAL>(*this, moves) == moves;
+  return in_check() && !has_legal_move(*this);
 }
 
 
@@ -20,15 +20,14 @@
 #if !defined(POSITION_H_INCLUDED)
 #define POSITION_H_INCLUDED
 
+#include <atomic>
+#include <vector>
+
 #include "bitboard.h"
+#include "lock.h"
 #include "move.h"
 #include "types.h"
 
-/// Maximum number of plies per game (220 should be enough, because the
-/// maximum search depth is 100, and during position setup we reset the
-/// move counter for every non-reversible move).
-const int MaxGameLength = 220;
-
 class Position;
 
 /// struct checkInfo is initialized at c'tor time and keeps
@@ -77,6 +76,32 @@ struct StateInfo {
   Key key;
   Bitboard checkersBB;
   StateInfo* previous;
+
+  // Squares attacked by each color, valid for the colors set in attacksReady
+  Bitboard attackedBB[2];
+  int attacksReady;
+};
+
+
+/// The KeyHistory struct is the append-only stack of the hash keys of the
+/// positions played before the start state of a Position, indexed by game
+/// ply and used to detect repetition draws. The keys of the states reached
+/// by do_move() are found through the StateInfo chain, so only detach()
+/// writes here. A stack is shared by pointer among the copies of a position.
+/// A copy appends to it in place while the stack ends at the copy's last key,
+/// and takes a private copy only when its keys differ from the shared ones.
+/// The first size keys are in use, the buffer is never reallocated while it
+/// is shared, so the keys a position reads never move under its feet.
+
+struct KeyHistory {
+
+  KeyHistory() : refs(1), size(0) { lock_init(&lock); }
+  ~KeyHistory() { lock_destroy(&lock); }
+
+  std::atomic<int> refs;
+  int size;
+  std::vector<Key> keys;
+  Lock lock;
 };
 
 
@@ -98,14 +123,15 @@ struct StateInfo {
 ///    * The squares of the kings for both sides.
 ///    * Hash keys for the position itself, the current pawn structure, and
 ///      the current material situation.
-///    * Hash keys for all previous positions in the game for detecting
-///      repetition draws.
+///    * A pointer to the hash keys of all previous positions in the game for
+///      detecting repetition draws, shared with the copies of the position.
 ///    * A counter for detecting 50 move rule draws.
 
 class Position {
 
   Position(); // No default or copy c'tor allowed
   Position(const Position& pos);
+  Position& operator=(const Position& pos);
 
 public:
   enum GamePhase {
@@ -116,6 +142,7 @@ public:
   // Constructors
   Position(const Position& pos, int threadID);
   Position(const std::string& fen, bool isChess960, int threadID);
+  ~Position();
 
   // Text input/output
   void from_fen(const std::string& fen, bool isChess960);
@@ -180,6 +207,7 @@ public:
   static Bitboard attacks_from(Piece p, Square s, Bitboard occ);
   template<PieceType> Bitboard attacks_from(Square s) const;
   template<PieceType> Bitboard attacks_from(Square s, Color c) const;
+  Bitboard attacked_by(Color c) const;
 
   // Properties of moves
   bool pl_move_is_legal(Move m, Bitboard pinned) const;
@@ -214,9 +242,11 @@ public:
   int see(Square from, Square to) const;
   int see(Move m) const;
   int see_sign(Move m) const;
+  void see_all(MoveStack* first, MoveStack* last) const;
 
   // Accessing hash keys
   Key get_key() const;
+  Key key_after(Move m) const;
   Key get_exclusion_key() const;
   Key get_pawn_key() const;
   Key get_material_key() const;
@@ -258,6 +288,9 @@ private:
   // Initialization helper functions (used while setting up a position)
   void clear();
   void detach();
+  bool append_shared_history(int ply);
+  void release_history();
+  int repetitions(int maxCount) const;
   void put_piece(Piece p, Square s);
   void do_allow_oo(Color c);
   void do_allow_ooo(Color c);
@@ -268,6 +301,7 @@ private:
   void do_castle_move(Move m);
   void undo_castle_move(Move m);
   void find_checkers();
+  int see_swap(Square from, Square to, Bitboard occupied, Bitboard attackers, PieceType capturedType) const;
 
   template<bool FindPinned>
   Bitboard hidden_checkers(Color c) const;
@@ -297,7 +331,7 @@ private:
 
   // Other info
   Color sideToMove;
-  Key history[MaxGameLength];
+  KeyHistory* history;
   int castleRightsMask[64];
   StateInfo startState;
   File initialKFile, initialKRFile, initialQRFile;
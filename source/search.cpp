@@ -318,32 +318,185 @@ void init_search() {
 }
 
 
+namespace {
+
+  // Perft hash table entry. The check word is the key of the position mixed
+  // with the depth and xored with the leaf count, so that an entry torn by
+  // the concurrent write of another thread fails the check and is ignored.
+  struct PerftEntry {
+    Key check;
+    uint64_t count;
+  };
+
+  // The job of a perft thread: the root moves are handed out one at a time
+  // and each thread counts them on its own copy of the root position.
+  struct PerftJob {
+    const Position* root;
+    const MoveStack* moves;
+    int64_t* counts;
+    volatile int* next;
+    Lock* lock;
+    PerftEntry* table;
+    size_t tableMask;
+    int moveCount, threadID;
+    Depth depth;
+  };
+
+  int64_t hashed_perft(Position& pos, Depth depth, PerftEntry* table, size_t tableMask) {
+
+    // At the last ply the legal moves are counted in bulk
+    if (depth <= ONE_PLY)
+        return count_legal(pos);
+
+    Key key = pos.get_key() ^ (Key(depth / ONE_PLY) * 0x9E3779B97F4A7C15ULL);
+    PerftEntry* e = table + (key & tableMask);
+    uint64_t count = e->count;
+
+    if ((e->check ^ count) == key)
+        return int64_t(count);
+
+    MoveStack mlist[MAX_MOVES];
+    StateInfo st;
+    int64_t sum = 0;
+
+    MoveStack* last = generate<MV_LEGAL>(pos, mlist);
+    CheckInfo ci(pos);
+
+    for (MoveStack* cur = mlist; cur != last; cur++)
+    {
+        Move m = cur->move;
+        pos.do_move(m, st, ci, pos.move_gives_check(m, ci));
+        sum += hashed_perft(pos, depth - ONE_PLY, table, tableMask);
+        pos.undo_move(m);
+    }
+
+    e->count = uint64_t(sum);
+    e->check = key ^ uint64_t(sum);
+    return sum;
+  }
+
+  void run_perft_job(PerftJob* job) {
+
+    Position pos(*job->root, job->threadID);
+    StateInfo st;
+
+    while (true)
+    {
+        lock_grab(job->lock);
+        int i = (*job->next)++;
+        lock_release(job->lock);
+
+        if (i >= job->moveCount)
+            break;
+
+        if (job->depth <= ONE_PLY)
+        {
+            job->counts[i] = 1;
+            continue;
+        }
+
+        Move m = job->moves[i].move;
+        pos.do_move(m, st);
+        job->counts[i] = hashed_perft(pos, job->depth - ONE_PLY, job->table, job->tableMask);
+        pos.undo_move(m);
+    }
+  }
+
+  extern "C" {
+
+#if defined(_MSC_VER)
+  DWORD WINAPI perft_routine(LPVOID job) { run_perft_job((PerftJob*)job); return 0; }
+#else
+  void* perft_routine(void* job) { run_perft_job((PerftJob*)job); return NULL; }
+#endif
+
+  }
+
+} // namespace
+
+
 /// perft() is our utility to verify move generation. All the leaf nodes up to
-/// the given depth are generated and counted and the sum returned.
+/// the given depth are counted and the sum returned. The root moves are split
+/// among the given number of threads, the calling one included, which share a
+/// table of the counts of the subtrees already visited, sized by the "Hash"
+/// option. With divide the count of each root move is printed as well.
 
-int64_t perft(Position& pos, Depth depth) {
+int64_t perft(Position& pos, Depth depth, int threads, bool divide) {
 
   MoveStack mlist[MAX_MOVES];
-  StateInfo st;
-  Move m;
-  int64_t sum = 0;
+  int64_t counts[MAX_MOVES], sum = 0;
+  PerftJob jobs[MAX_THREADS];
+#if defined(_MSC_VER)
+  HANDLE handles[MAX_THREADS];
+#else
+  pthread_t handles[MAX_THREADS];
+#endif
+  volatile int next = 0;
+  Lock lock;
+
+  int moveCount = int(generate<MV_LEGAL>(pos, mlist) - mlist);
+  threads = Max(1, Min(threads, Min(moveCount, MAX_THREADS)));
+
+  // Size the table to the largest power of two that fits in the hash size,
+  // it is never probed when the subtrees of the root moves are too shallow.
+  size_t mbSize = Options["Hash"].value<int>();
+  size_t size = 1;
+  while (depth > 2 * ONE_PLY && 2ULL * size * sizeof(PerftEntry) <= (mbSize << 20))
+      size *= 2;
+
+  PerftEntry* table = new (std::nothrow) PerftEntry[size];
+  if (!table)
+  {
+      std::cerr << "Failed to allocate " << mbSize
+                << " MB for perft table." << std::endl;
+      exit(EXIT_FAILURE);
+  }
+  memset(table, 0, size * sizeof(PerftEntry));
+
+  lock_init(&lock);
+  for (int i = 0; i < threads; i++)
+  {
+      jobs[i].root = &pos;
+      jobs[i].moves = mlist;
+      jobs[i].counts = counts;
+      jobs[i].next = &next;
+      jobs[i].lock = &lock;
+      jobs[i].table = table;
+      jobs[i].tableMask = size - 1;
+      jobs[i].moveCount = moveCount;
+      jobs[i].threadID = i;
+      jobs[i].depth = depth;
+  }
 
-  // Generate all legal moves
-  MoveStack* last = generate<MV_LEGAL>(pos, mlist);
+  int started = 1;
+  for ( ; started < threads; started++)
+#if defined(_MSC_VER)
+      if (!(handles[started] = CreateThread(NULL, 0, perft_routine, (LPVOID)&jobs[started], 0, NULL)))
+#else
+      if (pthread_create(&handles[started], NULL, perft_routine, (void*)&jobs[started]))
+#endif
+          break;
 
-  // If we are at the last ply we don't need to do and undo
-  // the moves, just to count them.
-  if (depth <= ONE_PLY)
-      return int(last - mlist);
+  run_perft_job(&jobs[0]);
+
+  for (int i = 1; i < started; i++)
+  {
+#if defined(_MSC_VER)
+      WaitForSingleObject(handles[i], INFINITE);
+      CloseHandle(handles[i]);
+#else
+      pthread_join(handles[i], NULL);
+#endif
+  }
+  lock_destroy(&lock);
+  delete [] table;
 
-  // Loop through all legal moves
-  CheckInfo ci(pos);
-  for (MoveStack* cur = mlist; cur != last; cur++)
+  for (int i = 0; i < moveCount; i++)
   {
-      m = cur->move;
-      pos.do_move(m, st, ci, pos.move_gives_check(m, ci));
-      sum += perft(pos, depth - ONE_PLY);
-      pos.undo_move(m);
+      if (divide)
+          cout << move_to_uci(mlist[i].move, pos.is_chess960()) << ": " << counts[i] << endl;
+
+      sum += counts[i];
   }
   return sum;
 }
@@ -2142,8 +2295,23 @@ void ThreadsManager::idle_loop(int threadID, SplitPoint* sp) {
           lock_release(&threads[threadID].sleepLock);
       }
 
-      // If this thread has been assigned work, launch a search
-      if (threads[threadID].state == Thread::WORKISWAITING)
+      // If this thread has been assigned a task, run it and wake up the
+      // thread waiting for it in wait_task().
+      if (threads[threadID].state == Thread::WORKISWAITING && threads[threadID].task)
+      {
+          threads[threadID].state = Thread::SEARCHING;
+          threads[threadID].task(threads[threadID].taskData);
+
+          lock_grab(&threads[threadID].taskLock);
+          threads[threadID].task = NULL;
+          threads[threadID].state = Thread::AVAILABLE;
+          cond_signal(&threads[threadID].taskCond);
+          lock_release(&threads[threadID].taskLock);
+      }
+
+      // If this thread has been assigned work, launch a search. The task is
+      // set before the state, so a task handed after the test above is seen.
+      if (threads[threadID].state == Thread::WORKISWAITING && !threads[threadID].task)
       {
           assert(!allThreadsShouldExit);
 
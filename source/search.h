@@ -67,7 +67,7 @@ struct SearchLimits {
 };
 
 extern void init_search();
-extern int64_t perft(Position& pos, Depth depth);
+extern int64_t perft(Position& pos, Depth depth, int threads, bool divide);
 extern bool think(Position& pos, const SearchLimits& limits, Move searchMoves[]);
 
 #endif // !defined(SEARCH_H_INCLUDED)
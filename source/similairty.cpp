@@ -1,18 +1,50 @@
 #include <vector>
 #include <c++/cmath>
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <fstream>
 #include <ctime>
 
 #include "similarity.h"
+#include "misc.h"
 #include "position.h"
+#include "rkiss.h"
 #include "movegen.h"
 #include "move.h"
 
+/**
+ * Set of the positions expandable from a position: the keys of all its children, sorted in ascending order, each with
+ * the move leading to it. Keys are predicted with Position::key_after(), so no child position is ever made.
+ */
+struct ChildSet {
+    struct Child {
+        Key key;
+        Move move;
+        bool operator<(const Child& c) const { return key < c.key; }
+    };
+
+    explicit ChildSet(Position* pos);
+
+    Child children[MAX_MOVES];
+    int size;
+};
+
+template<SimMethod>
+double intersectionRec(Position* curPos, Position* prevPos, const MoveSet& v1, const MoveSet& v2, int depth);
 template<SimMethod>
-double intersectionRec(Position* curPos, Position* prevPos, std::vector<MoveStack> v1, std::vector<MoveStack> v2);
-double intersection(std::vector<MoveStack> v1, std::vector<MoveStack> v2);
+double similarityRec(Position* curPos, Position* prevPos, int depth);
+template<>
+double similarityRec<LEGAL_MOVES>(Position* curPos, Position* prevPos, int depth);
+template<>
+double similarityRec<EXPANDABLE_STATES>(Position* curPos, Position* prevPos, int depth);
+template<SimMethod>
+double cachedSimilarityRec(Position* curPos, Position* prevPos, int depth);
+template<SimMethod>
+bool matchesMismatch(Position* curPos, Position* prevPos, Move m, const MoveSet& v2, int depth);
+double intersection(const MoveSet& s1, const MoveSet& s2, MoveSet* rest1 = NULL, MoveSet* rest2 = NULL);
+double intersection(const ChildSet& s1, const ChildSet& s2, MoveSet* rest1 = NULL, MoveSet* rest2 = NULL);
 std::vector<MoveStack> getMoves(Position* pos);
 
 ///////////////////////////////////////////////////
@@ -37,11 +69,14 @@ double similarity<CONSTANT>(Position* curPos, Position* prevPos) {
  */
 template<>
 double similarity<DEPTH_BREADTH>(Position* curPos, Position* prevPos) {
+
+	if (!prevPos) return DEFAULT_SIM;
+
 	double curDepth  = curPos->startpos_ply_counter(),
 	       prevDepth = prevPos->startpos_ply_counter();
 
-	double curBreadth  = getMoves(curPos).size(),
-	       prevBreadth = getMoves(prevPos).size();
+	double curBreadth  = count_legal(*curPos),
+	       prevBreadth = count_legal(*prevPos);
 
     double depthComponent;
     if (curDepth + prevDepth == 0) depthComponent = 1;
@@ -91,12 +126,20 @@ double similarity<LEGAL_MOVES>(Position* curPos, Position* prevPos) {
 
 	if (!prevPos) return DEFAULT_SIM;
 
-	std::vector<MoveStack> curMoves  = getMoves(curPos),
-                           prevMoves = getMoves(prevPos);
+	return similarity(MoveSet(curPos), MoveSet(prevPos));
+}
+
+/**
+ * Intersection-to-union ratio of two sets of legal moves, see @similarity<LEGAL_MOVES>().
+ * @param curMoves legal moves of the current board state
+ * @param prevMoves legal moves of the reference board state
+ * @return similarity between the positions of curMoves and prevMoves
+ */
+double similarity(const MoveSet& curMoves, const MoveSet& prevMoves) {
 
-	if (curMoves.size()==0 && prevMoves.size()==0) return 1.0;
+	if (curMoves.size==0 && prevMoves.size==0) return 1.0;
 
-	double uni = curMoves.size() + prevMoves.size();
+	double uni = curMoves.size + prevMoves.size;
 	double inter = intersection(curMoves, prevMoves);
 	uni = uni - inter;
 
@@ -112,31 +155,7 @@ double similarity<LEGAL_MOVES>(Position* curPos, Position* prevPos) {
  */
 template<>
 double similarity<REC_LEGAL_MOVES>(Position* curPos, Position* prevPos) {
-
-	if (!prevPos) return DEFAULT_SIM;
-
-    std::vector<MoveStack> curMoves  = getMoves(curPos),
-	                       prevMoves = getMoves(prevPos);
-
-    double inter = 0,
-           uni   = curMoves.size() + prevMoves.size();
-
-    for (long long i = curMoves.size()-1; i >= 0; i--) {
-        if (curMoves.empty()) break;
-        for (long long j = prevMoves.size()-1; j >= 0; j--) {
-            if (prevMoves.empty()) break;
-            if (curMoves[i].move == prevMoves[j].move) {
-                curMoves.erase(curMoves.begin()+i);
-                prevMoves.erase(prevMoves.begin()+j);
-                inter++;
-                break;
-            }
-        }
-    }
-
-    double simMismatches = intersectionRec<LEGAL_MOVES>(curPos, prevPos, curMoves, prevMoves);
-	uni = uni - inter;
-	return (inter + simMismatches) / uni;
+    return similarityRec<LEGAL_MOVES>(curPos, prevPos, 1);
 }
 
 /**
@@ -150,28 +169,10 @@ double similarity<EXPANDABLE_STATES>(Position* curPos, Position* prevPos) {
 
 	if (!prevPos) return DEFAULT_SIM;
 
-	std::vector<MoveStack> curMoves = getMoves(curPos),
-			               prevMoves = getMoves(prevPos);
-
-	Position *p1, *p2;
-	StateInfo st1, st2;
-	double inter = 0,
-	       uni   = curMoves.size() + prevMoves.size();
-
-	for (unsigned int i = 0; i < curMoves.size(); i++) {
-		for (unsigned int j = 0; j < prevMoves.size(); j++) {
-			p1 = new Position(*curPos, curPos->thread());
-			p2 = new Position(*prevPos, prevPos->thread());
-			p1->do_move(curMoves[i].move, st1);
-			p2->do_move(prevMoves[j].move, st2);
-
-			if (p1->get_key() == p2->get_key()) {
-				prevMoves.erase(prevMoves.begin()+j);
-				inter++;
-				break;
-			}
-		}
-	}
+	ChildSet curChildren(curPos), prevChildren(prevPos);
+
+	double inter = intersection(curChildren, prevChildren),
+	       uni   = curChildren.size + prevChildren.size;
 
 	uni = uni - inter;
 	return inter / uni;
@@ -186,40 +187,310 @@ double similarity<EXPANDABLE_STATES>(Position* curPos, Position* prevPos) {
  */
 template<>
 double similarity<REC_EXPANDABLE_STATES>(Position* curPos, Position* prevPos) {
+    return similarityRec<EXPANDABLE_STATES>(curPos, prevPos, 1);
+}
+
+/**
+ * Recursive variant of @similarity<LEGAL_MOVES>() at a given depth of the recursion, see @similarity<REC_LEGAL_MOVES>().
+ * @param curPos current board state
+ * @param prevPos reference board state
+ * @param depth depth of the recursion, 1 at the top level
+ * @return similarity between curPos and prevPos
+ */
+template<>
+double similarityRec<LEGAL_MOVES>(Position* curPos, Position* prevPos, int depth) {
 
 	if (!prevPos) return DEFAULT_SIM;
 
-	std::vector<MoveStack> curMoves = getMoves(curPos),
-			prevMoves = getMoves(prevPos);
-
-	double inter = 0,
-		   uni   = curMoves.size() + prevMoves.size();
-
-	Position *p1, *p2;
-	StateInfo st1, st2;
-	for (long long i = curMoves.size()-1; i >= 0; i--) {
-        if (curMoves.empty() || prevMoves.empty()) break;
-		for (long long j = prevMoves.size()-1; j >= 0; j--) {
-			p1 = new Position(*curPos, curPos->thread());
-			p2 = new Position(*prevPos, prevPos->thread());
-			p1->do_move(curMoves[i].move, st1);
-			p2->do_move(prevMoves[j].move, st2);
-
-			if (p1->get_key() == p2->get_key()) {
-				curMoves.erase(curMoves.begin()+i);
-				prevMoves.erase(prevMoves.begin()+j);
-				inter++;
-				break;
-			}
-		}
-	}
+    MoveSet curMoves(curPos), prevMoves(prevPos), curRest, prevRest;
+
+    double inter = intersection(curMoves, prevMoves, &curRest, &prevRest),
+           uni   = curMoves.size + prevMoves.size;
+
+    double simMismatches = intersectionRec<LEGAL_MOVES>(curPos, prevPos, curRest, prevRest, depth);
+	uni = uni - inter;
+	return (inter + simMismatches) / uni;
+}
+
+/**
+ * Recursive variant of @similarity<EXPANDABLE_STATES>() at a given depth of the recursion, see
+ * @similarity<REC_EXPANDABLE_STATES>().
+ * @param curPos current board state
+ * @param prevPos reference board state
+ * @param depth depth of the recursion, 1 at the top level
+ * @return similarity between curPos and prevPos
+ */
+template<>
+double similarityRec<EXPANDABLE_STATES>(Position* curPos, Position* prevPos, int depth) {
 
-    double simMismatches = intersectionRec<EXPANDABLE_STATES>(curPos, prevPos, curMoves, prevMoves);
+	if (!prevPos) return DEFAULT_SIM;
+
+	ChildSet curChildren(curPos), prevChildren(prevPos);
+	MoveSet curRest, prevRest;
+
+	double inter = intersection(curChildren, prevChildren, &curRest, &prevRest),
+		   uni   = curChildren.size + prevChildren.size;
+
+    double simMismatches = intersectionRec<EXPANDABLE_STATES>(curPos, prevPos, curRest, prevRest, depth);
 	uni = uni - inter - simMismatches;
 	return (inter + simMismatches) / uni;
 }
 
 
+///////////////////////////////////////////////////
+/// SIMILARITY CACHE
+///////////////////////////////////////////////////
+namespace {
+
+    /**
+     * Entry of the similarity cache. The value is stored together with its key xor-ed with the value bits, so an
+     * entry torn by two threads writing at once fails the key check instead of returning a wrong value.
+     */
+    struct SimEntry {
+        volatile uint64_t check, data;
+    };
+
+    SimEntry simCache[SIM_CACHE_SIZE];
+
+    int recDepth = 1;
+
+    /**
+     * Key of a similarity result: the keys of both positions, the similarity method and the depth of the recursion.
+     * The recursive methods count the matches of the first position only, so their position order matters.
+     */
+    Key simKey(SimMethod simMethod, int depth, Key k1, Key k2) {
+        if (simMethod != REC_LEGAL_MOVES && simMethod != REC_EXPANDABLE_STATES && k1 > k2)
+            std::swap(k1, k2);
+
+        Key key = k1 * 0x9E3779B97F4A7C15ULL;
+        key ^= (k2 << 31) | (k2 >> 33);
+        key ^= Key(simMethod * 16 + depth + 1) * 0xC2B2AE3D27D4EB4FULL;
+        return key;
+    }
+
+    bool simProbe(Key key, double& sim) {
+        const SimEntry& e = simCache[key & (SIM_CACHE_SIZE - 1)];
+        uint64_t data = e.data, check = e.check;
+
+        if ((check ^ data) != key)
+            return false;
+
+        memcpy(&sim, &data, sizeof(double));
+        return true;
+    }
+
+    void simStore(Key key, double sim) {
+        SimEntry& e = simCache[key & (SIM_CACHE_SIZE - 1)];
+        uint64_t data;
+
+        memcpy(&data, &sim, sizeof(double));
+        e.data = data;
+        e.check = key ^ data;
+    }
+}
+
+/**
+ * Memoized @similarity<SimMethod>(). Results of the move and position based measures are kept in a bounded cache
+ * shared by all callers, the cheap measures (and those depending on more than the position keys) are not cached.
+ * @param curPos current board state
+ * @param prevPos reference board state
+ * @return similarity between curPos and prevPos
+ */
+template<SimMethod simMethod>
+double cachedSimilarity(Position* curPos, Position* prevPos) {
+
+    if (!prevPos || simMethod < LEGAL_MOVES)
+        return similarity<simMethod>(curPos, prevPos);
+
+    double sim;
+    Key key = simKey(simMethod, 0, curPos->get_key(), prevPos->get_key());
+    if (!simProbe(key, sim)) {
+        sim = similarity<simMethod>(curPos, prevPos);
+        simStore(key, sim);
+    }
+    return sim;
+}
+
+template double cachedSimilarity<CONSTANT>(Position* curPos, Position* prevPos);
+template double cachedSimilarity<DEPTH_BREADTH>(Position* curPos, Position* prevPos);
+template double cachedSimilarity<INFL_PIECES>(Position* curPos, Position* prevPos);
+template double cachedSimilarity<LEGAL_MOVES>(Position* curPos, Position* prevPos);
+template double cachedSimilarity<REC_LEGAL_MOVES>(Position* curPos, Position* prevPos);
+template double cachedSimilarity<EXPANDABLE_STATES>(Position* curPos, Position* prevPos);
+template double cachedSimilarity<REC_EXPANDABLE_STATES>(Position* curPos, Position* prevPos);
+
+/**
+ * Memoized @similarityRec<SimMethod>() used for the mismatches below the top level of the recursion.
+ * @param curPos current board state
+ * @param prevPos reference board state
+ * @param depth depth of the recursion
+ * @return similarity between curPos and prevPos
+ */
+template<SimMethod simMethod>
+double cachedSimilarityRec(Position* curPos, Position* prevPos, int depth) {
+
+    double sim;
+    Key key = simKey(simMethod == LEGAL_MOVES ? REC_LEGAL_MOVES : REC_EXPANDABLE_STATES, depth,
+                     curPos->get_key(), prevPos->get_key());
+    if (!simProbe(key, sim)) {
+        sim = similarityRec<simMethod>(curPos, prevPos, depth);
+        simStore(key, sim);
+    }
+    return sim;
+}
+
+/**
+ * Estimate a recursive similarity from a random sample of the mismatches of the current position. Each sampled
+ * mismatch is checked exactly, the share of the matched ones is extrapolated to all mismatches and bounded by
+ * a Wilson score interval corrected for the finite number of mismatches.
+ * @tparam simMethod similarity method extended recursively (LEGAL_MOVES or EXPANDABLE_STATES)
+ * @param curPos current board state
+ * @param prevPos reference board state
+ * @param budget time budget in microseconds
+ * @return estimated similarity between curPos and prevPos
+ */
+template<SimMethod simMethod>
+SimEstimate sampledSimilarityRec(Position* curPos, Position* prevPos, int budget) {
+
+    int64_t deadline = get_system_time_us() + budget;
+    MoveSet curRest, prevRest;
+    double inter, uni;
+
+    if (simMethod == LEGAL_MOVES) {
+        MoveSet curMoves(curPos), prevMoves(prevPos);
+        inter = intersection(curMoves, prevMoves, &curRest, &prevRest);
+        uni   = curMoves.size + prevMoves.size;
+    } else {
+        ChildSet curChildren(curPos), prevChildren(prevPos);
+        inter = intersection(curChildren, prevChildren, &curRest, &prevRest);
+        uni   = curChildren.size + prevChildren.size;
+    }
+
+    // Visit the mismatches in a random order, the same for every call on the same pair of positions
+    RKISS rk(curPos->get_key() ^ prevPos->get_key());
+    for (int i = curRest.size - 1; i > 0; i--)
+        std::swap(curRest.moves[i], curRest.moves[rk.rand<unsigned int>() % (i + 1)]);
+
+    int n = curRest.size, k = 0, matched = 0;
+    while (k < n && (k == 0 || get_system_time_us() < deadline))
+        matched += matchesMismatch<simMethod>(curPos, prevPos, curRest.moves[k++], prevRest, 1);
+
+    double low = matched, high = matched, mid = matched;
+    if (k < n) {
+        // The finite population correction enlarges the sample size used by the interval
+        const double z = 1.96;
+        double p = double(matched) / k, m = k * (n - 1.0) / (n - k);
+        double centre = (p + z * z / (2 * m)) / (1 + z * z / m),
+               half   = z / (1 + z * z / m) * sqrt(p * (1 - p) / m + z * z / (4 * m * m));
+
+        mid  = p * n;
+        low  = std::max(double(matched), (centre - half) * n);
+        high = std::min(double(matched + n - k), (centre + half) * n);
+    }
+
+    // Similarity for a given number of matched mismatches, increasing in that number
+    SimEstimate e;
+    double* bounds[] = { &e.sim, &e.low, &e.high };
+    double counts[] = { mid, low, high };
+    for (int i = 0; i < 3; i++) {
+        double simMismatches = counts[i] * REC_INCREMENT;
+        double u = simMethod == LEGAL_MOVES ? uni - inter : uni - inter - simMismatches;
+        *bounds[i] = (inter + simMismatches) / u;
+    }
+    e.low = std::max(0.0, e.low);
+    e.high = std::min(1.0, e.high);
+    e.samples = k;
+    e.total = n;
+    return e;
+}
+
+/**
+ * Anytime variant of @similarity<SimMethod>(). The recursive measures are estimated from the mismatches checked
+ * within the time budget, the remaining measures are calculated exactly. A zero budget always gives the exact value.
+ * @param curPos current board state
+ * @param prevPos reference board state
+ * @param budget time budget in microseconds
+ * @return similarity between curPos and prevPos with its confidence interval
+ */
+template<SimMethod simMethod>
+SimEstimate sampledSimilarity(Position* curPos, Position* prevPos, int budget) {
+
+    SimEstimate e;
+    double sim;
+
+    if (   !prevPos
+        || !budget
+        || (simMethod != REC_LEGAL_MOVES && simMethod != REC_EXPANDABLE_STATES)
+        || simProbe(simKey(simMethod, 0, curPos->get_key(), prevPos->get_key()), sim))
+    {
+        e.sim = e.low = e.high = cachedSimilarity<simMethod>(curPos, prevPos);
+        e.samples = e.total = 0;
+        return e;
+    }
+
+    e = sampledSimilarityRec<simMethod == REC_LEGAL_MOVES ? LEGAL_MOVES : EXPANDABLE_STATES>(curPos, prevPos, budget);
+
+    // An exhausted sample is the exact value
+    if (e.samples == e.total)
+        simStore(simKey(simMethod, 0, curPos->get_key(), prevPos->get_key()), e.sim);
+    return e;
+}
+
+template SimEstimate sampledSimilarity<CONSTANT>(Position* curPos, Position* prevPos, int budget);
+template SimEstimate sampledSimilarity<DEPTH_BREADTH>(Position* curPos, Position* prevPos, int budget);
+template SimEstimate sampledSimilarity<INFL_PIECES>(Position* curPos, Position* prevPos, int budget);
+template SimEstimate sampledSimilarity<LEGAL_MOVES>(Position* curPos, Position* prevPos, int budget);
+template SimEstimate sampledSimilarity<REC_LEGAL_MOVES>(Position* curPos, Position* prevPos, int budget);
+template SimEstimate sampledSimilarity<EXPANDABLE_STATES>(Position* curPos, Position* prevPos, int budget);
+template SimEstimate sampledSimilarity<REC_EXPANDABLE_STATES>(Position* curPos, Position* prevPos, int budget);
+
+const SimMethodInfo SimMethods[SIM_METHOD_NB] = {
+    { CONSTANT,              "Constant",            COST_CONSTANT,
+      &cachedSimilarity<CONSTANT>,              &sampledSimilarity<CONSTANT> },
+    { DEPTH_BREADTH,         "DepthBreadth",        COST_LINEAR,
+      &cachedSimilarity<DEPTH_BREADTH>,         &sampledSimilarity<DEPTH_BREADTH> },
+    { INFL_PIECES,           "InflPieces",          COST_CONSTANT,
+      &cachedSimilarity<INFL_PIECES>,           &sampledSimilarity<INFL_PIECES> },
+    { LEGAL_MOVES,           "LegalMoves",          COST_LINEAR,
+      &cachedSimilarity<LEGAL_MOVES>,           &sampledSimilarity<LEGAL_MOVES> },
+    { REC_LEGAL_MOVES,       "RecLegalMoves",       COST_QUADRATIC,
+      &cachedSimilarity<REC_LEGAL_MOVES>,       &sampledSimilarity<REC_LEGAL_MOVES> },
+    { EXPANDABLE_STATES,     "ExpandableStates",    COST_LINEAR,
+      &cachedSimilarity<EXPANDABLE_STATES>,     &sampledSimilarity<EXPANDABLE_STATES> },
+    { REC_EXPANDABLE_STATES, "RecExpandableStates", COST_QUADRATIC,
+      &cachedSimilarity<REC_EXPANDABLE_STATES>, &sampledSimilarity<REC_EXPANDABLE_STATES> }
+};
+
+/**
+ * Typical time in microseconds taken by a method of a given cost class, roughly measured on middle game positions.
+ * @param cost cost class of a method
+ * @return time in microseconds
+ */
+int simCostTime(SimCost cost) {
+    static const int CostTime[] = { 1, 100, 10000 };
+    return CostTime[cost];
+}
+
+/**
+ * Clear the similarity cache.
+ */
+void clearSimilarityCache() {
+    memset((void*)simCache, 0, sizeof(simCache));
+}
+
+void setSimilarityDepth(int depth) {
+    depth = std::max(1, std::min(depth, REC_MAX_DEPTH));
+    if (depth != recDepth) {
+        recDepth = depth;
+        clearSimilarityCache();
+    }
+}
+
+int similarityDepth() {
+    return recDepth;
+}
+
+
 ///////////////////////////////////////////////////
 /// HELPER METHODS
 ///////////////////////////////////////////////////
@@ -240,22 +511,95 @@ std::vector<MoveStack> getMoves(Position* pos) {
 }
 
 /**
- * Perform an intersection of two sets of moves and return its cardinality.
- * @param v1 first set of moves stored as a vector
- * @param v2 second set of moves stored as a vector
+ * Generate the legal moves from a given position and store them sorted in a move set.
+ * @param pos board state to consider
+ */
+MoveSet::MoveSet(Position* pos) {
+    MoveStack moveList[MAX_MOVES];
+
+    MoveStack *last = generate<MV_LEGAL>(*pos, moveList);
+    for (size = 0; moveList + size != last; size++)
+        moves[size] = moveList[size].move;
+
+    std::sort(moves, moves + size);
+}
+
+/**
+ * Perform an intersection of two sets of moves with a single merge and return its cardinality.
+ * @param s1 first set of moves
+ * @param s2 second set of moves
+ * @param rest1 if given, receives the moves of s1 missing from s2
+ * @param rest2 if given, receives the moves of s2 missing from s1
  * @return Size of the intersection
  */
-double intersection(std::vector<MoveStack> v1, std::vector<MoveStack> v2) {
-    double inter = 0;
-    for (unsigned int i = 0; i < v1.size(); i++) {
-        for (unsigned int j = 0; j < v2.size(); j++) {
-            if (v1[i].move == v2[j].move) {
-                v2.erase(v2.begin()+j);		// remove matches from consideration for speed-up
-                inter++; 						// string s = move_to_uci(v2[j].move, false);
-                break;
-            }
+double intersection(const MoveSet& s1, const MoveSet& s2, MoveSet* rest1, MoveSet* rest2) {
+    int i = 0, j = 0, inter = 0;
+    while (i < s1.size && j < s2.size) {
+        if (s1.moves[i] == s2.moves[j]) {
+            inter++; i++; j++;
+        }
+        else if (s1.moves[i] < s2.moves[j]) {
+            if (rest1) rest1->moves[rest1->size++] = s1.moves[i];
+            i++;
+        }
+        else {
+            if (rest2) rest2->moves[rest2->size++] = s2.moves[j];
+            j++;
+        }
+    }
+    for ( ; rest1 && i < s1.size; i++)
+        rest1->moves[rest1->size++] = s1.moves[i];
+    for ( ; rest2 && j < s2.size; j++)
+        rest2->moves[rest2->size++] = s2.moves[j];
+    return inter;
+}
+
+/**
+ * Predict the keys of all the children of a given position and store them sorted in a child set.
+ * @param pos board state to consider
+ */
+ChildSet::ChildSet(Position* pos) {
+    MoveStack moveList[MAX_MOVES];
+
+    MoveStack *last = generate<MV_LEGAL>(*pos, moveList);
+    for (size = 0; moveList + size != last; size++) {
+        children[size].move = moveList[size].move;
+        children[size].key  = pos->key_after(moveList[size].move);
+    }
+
+    std::sort(children, children + size);
+}
+
+/**
+ * Perform an intersection of two sets of expandable positions with a single merge and return its cardinality.
+ * @param s1 first set of positions
+ * @param s2 second set of positions
+ * @param rest1 if given, receives the moves of s1 leading to positions missing from s2
+ * @param rest2 if given, receives the moves of s2 leading to positions missing from s1
+ * @return Size of the intersection
+ */
+double intersection(const ChildSet& s1, const ChildSet& s2, MoveSet* rest1, MoveSet* rest2) {
+    int i = 0, j = 0, inter = 0;
+    while (i < s1.size && j < s2.size) {
+        if (s1.children[i].key == s2.children[j].key) {
+            inter++; i++; j++;
+        }
+        else if (s1.children[i].key < s2.children[j].key) {
+            if (rest1) rest1->moves[rest1->size++] = s1.children[i].move;
+            i++;
+        }
+        else {
+            if (rest2) rest2->moves[rest2->size++] = s2.children[j].move;
+            j++;
         }
     }
+    for ( ; rest1 && i < s1.size; i++)
+        rest1->moves[rest1->size++] = s1.children[i].move;
+    for ( ; rest2 && j < s2.size; j++)
+        rest2->moves[rest2->size++] = s2.children[j].move;
+
+    if (rest1) std::sort(rest1->moves, rest1->moves + rest1->size);
+    if (rest2) std::sort(rest2->moves, rest2->moves + rest2->size);
     return inter;
 }
 
@@ -271,31 +615,45 @@ double intersection(std::vector<MoveStack> v1, std::vector<MoveStack> v2) {
  * @return sum of the intersection's size and the number similar moves
  */
 template<SimMethod simMethod>
-double intersectionRec(Position* curPos, Position* prevPos,
-                       std::vector<MoveStack> v1, std::vector<MoveStack> v2) {
+double intersectionRec(Position* curPos, Position* prevPos, const MoveSet& v1, const MoveSet& v2, int depth) {
 
-    Position *p1, *p2;
-    StateInfo st1, st2{};
     double inter = 0;
 
-    for (unsigned int i = 0; i < v1.size(); i++) {
-        for (unsigned int j = 0; j < v2.size(); j++) {
-            p1 = new Position(*curPos, curPos->thread());
-            p2 = new Position(*prevPos, prevPos->thread());
-            p1->do_move(v1[i].move, st1);
-            p2->do_move(v2[j].move, st2);
-
-            if (p1->get_key() == p2->get_key()) {
-                inter += REC_INCREMENT;
-                break;
-            }
-
-            double sim = similarity<simMethod>(p1, p2);
-            if (sim > ACC_THRESHOLD) {
-                inter += REC_INCREMENT; // alternatively: sim * REC_INCREMENT
-                break;
-            }
-        }
-    }
+    for (int i = 0; i < v1.size; i++)
+        if (matchesMismatch<simMethod>(curPos, prevPos, v1.moves[i], v2, depth))
+            inter += REC_INCREMENT; // alternatively: sim * REC_INCREMENT
     return inter;
+}
+
+/**
+ * Check whether a mismatched move from the current position is sufficiently similar to any of the mismatched moves
+ * from the reference position, see @intersectionRec<SimMethod>().
+ * @tparam simMethod similairty method used to compare the mismatches
+ * @param curPos current board state
+ * @param prevPos reference board state
+ * @param m mismatched move from curPos
+ * @param v2 set of mismatched moves from prevPos
+ * @param depth depth of the recursion
+ * @return true if a similar move is found
+ */
+template<SimMethod simMethod>
+bool matchesMismatch(Position* curPos, Position* prevPos, Move m, const MoveSet& v2, int depth) {
+
+    StateInfo st1, st2;
+    Position p1(*curPos, curPos->thread());
+    p1.do_move(m, st1);
+
+    for (int j = 0; j < v2.size; j++) {
+        if (p1.get_key() == prevPos->key_after(v2.moves[j]))
+            return true;
+
+        Position p2(*prevPos, prevPos->thread());
+        p2.do_move(v2.moves[j], st2);
+
+        double sim = depth < recDepth ? cachedSimilarityRec<simMethod>(&p1, &p2, depth + 1)
+                                           : cachedSimilarity<simMethod>(&p1, &p2);
+        if (sim > ACC_THRESHOLD)
+            return true;
+    }
+    return false;
 }
\ No newline at end of file
@@ -1,3 +1,5 @@
+#include <vector>
+
 #include "position.h"
 
 #ifndef SIMILARITY_H_
@@ -10,7 +12,18 @@ enum SimMethod {
     LEGAL_MOVES,
     REC_LEGAL_MOVES,
     EXPANDABLE_STATES,
-    REC_EXPANDABLE_STATES
+    REC_EXPANDABLE_STATES,
+    SIM_METHOD_NB
+};
+
+/**
+ * Cost class of a similarity method, from the measures free of any move generation to the recursive ones comparing
+ * the children of every mismatch.
+ */
+enum SimCost {
+    COST_CONSTANT,
+    COST_LINEAR,
+    COST_QUADRATIC
 };
 
 /** Constants **/
@@ -20,6 +33,20 @@ const double DEFAULT_SIM    = 1.0,   // default similarity value (in case of err
              BREADTH_WEIGHT = 1,     // weight factor of tree breadth used for @similarity<DEPTH_BREADTH>()
              ACC_THRESHOLD  = 0.6,   // threshold for accepting a recursively expanded mismatch in @similarity<REC_*>()
              REC_INCREMENT  = 1;     // value to increment the intersection if mismatch accepted in @similarity<REC_*>()
+const int    REC_MAX_DEPTH  = 3,     // deepest recursion allowed by @setSimilarityDepth()
+             SIM_CACHE_SIZE = 1 << 16; // number of entries of the similarity cache (power of two)
+
+/**
+ * Compact set of the legal moves of a position: the 16-bit moves sorted in ascending order. It lives on the stack,
+ * so building and intersecting move sets never allocates.
+ */
+struct MoveSet {
+    MoveSet() : size(0) {}
+    explicit MoveSet(Position* pos);
+
+    Move moves[MAX_MOVES];
+    int size;
+};
 
 /**
  * Calculate the similarity measure between two arbitrary board positions. If the reference position is not defined
@@ -31,6 +58,88 @@ const double DEFAULT_SIM    = 1.0,   // default similarity value (in case of err
 template<SimMethod>
 double similarity(Position* curPos, Position* prevPos);
 
+/**
+ * Calculate @similarity<LEGAL_MOVES>() from the precomputed legal moves of both positions.
+ * @param curMoves legal moves of the current board state
+ * @param prevMoves legal moves of the reference board state
+ * @return similarity of the positions (real number between 0 and 1 inclusive)
+ */
+double similarity(const MoveSet& curMoves, const MoveSet& prevMoves);
+
+/**
+ * Memoized @similarity<SimMethod>(). Results are shared by all callers through a bounded cache indexed by the keys
+ * of both positions, so repeated comparisons of the same pair of positions are computed only once.
+ * @param curPos current board state
+ * @param prevPos reference board state
+ * @return similarity of curPos and prevPos (real number between 0 and 1 inclusive)
+ */
+template<SimMethod>
+double cachedSimilarity(Position* curPos, Position* prevPos);
+
+/**
+ * Similarity estimated from a sample of the mismatches, see @sampledSimilarity<SimMethod>().
+ */
+struct SimEstimate {
+    double sim;      // estimated similarity
+    double low;      // lower bound of the 95% confidence interval
+    double high;     // upper bound of the 95% confidence interval
+    int samples;     // number of mismatches checked
+    int total;       // number of mismatches, equal to samples if the value is exact
+};
+
+/**
+ * Anytime similarity. The recursive measures check the mismatches in a random order until the time budget expires
+ * and extrapolate the similarity from the checked ones, any other measure is calculated exactly.
+ * @param curPos current board state
+ * @param prevPos reference board state
+ * @param budget time budget in microseconds, 0 for the exact similarity
+ * @return estimated similarity of curPos and prevPos with its confidence interval
+ */
+template<SimMethod>
+SimEstimate sampledSimilarity(Position* curPos, Position* prevPos, int budget);
+
+/**
+ * Clear the cache of @cachedSimilarity<SimMethod>().
+ */
+void clearSimilarityCache();
+
+/**
+ * Set the depth of the recursion in @similarity<REC_*>(), 1 compares the mismatches flat. The cached recursive
+ * results depend on the depth, so changing it clears the cache.
+ * @param depth depth of the recursion, between 1 and REC_MAX_DEPTH
+ */
+void setSimilarityDepth(int depth);
+
+/**
+ * Depth of the recursion in @similarity<REC_*>(), see @setSimilarityDepth().
+ * @return depth of the recursion
+ */
+int similarityDepth();
+
+/**
+ * Entry of the similarity dispatch table: a similarity method with its option name, cost class and the instantiations
+ * of @cachedSimilarity<SimMethod>() and @sampledSimilarity<SimMethod>().
+ */
+struct SimMethodInfo {
+    SimMethod method;
+    const char* name;
+    SimCost cost;
+    double (*similarity)(Position* curPos, Position* prevPos);
+    SimEstimate (*sampled)(Position* curPos, Position* prevPos, int budget);
+};
+
+/**
+ * Dispatch table of all similarity methods, indexed by SimMethod.
+ */
+extern const SimMethodInfo SimMethods[SIM_METHOD_NB];
+
+/**
+ * Typical time in microseconds taken by a method of a given cost class, used to pick a method fitting the move time.
+ * @param cost cost class of a method
+ * @return time in microseconds
+ */
+int simCostTime(SimCost cost);
+
 /**
  * Generate all legal moves from a recorded position
  * @param pos pointer to the position to be investigated
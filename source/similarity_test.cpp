@@ -1,22 +1,33 @@
 #include <vector>
-#include <c++/cmath>
+#include <cmath>
 
+#include <algorithm>
+#include <cstdio>
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <ctime>
 #include <regex>
-#include <direct.h>
+
+#if defined(_WIN32)
+#  include <direct.h>
+#else
+#  include <sys/stat.h>
+#endif
 
 #include "similarity_test.h"
 #include "similarity.h"
+#include "misc.h"
 #include "movegen.h"
 #include "move.h"
+#include "thread.h"
 
 void autoTest();
 void childTest();
 void manTest();
 
 std::string getTimeStamp();
+int makeDirectory(const std::string& path);
 
 double simFromKey(int key, Position *pos1, Position *pos2);
 double simFromKey(int key, std::string fen1, std::string fen2);
@@ -48,9 +59,9 @@ void similarityTest() {
 void autoTest() {
     std::ifstream testFile;
     std::ofstream resultFile;
-    std::string resultName = "..\\test\\result_auto_" + getTimeStamp() + ".csv";
+    std::string resultName = TEST_DIR + "result_auto_" + getTimeStamp() + ".csv";
 
-    testFile.open("..\\test\\auto_test_set.in");
+    testFile.open((TEST_DIR + "auto_test_set.in").c_str());
     resultFile.open(resultName);
 
     if (!testFile || !resultFile) {
@@ -139,17 +150,15 @@ void manTest() {
 
 void childTest() {
     std::ifstream testFile;
-    testFile.open("..\\test\\child_test_set.in");
+    testFile.open((TEST_DIR + "child_test_set.in").c_str());
     if (!testFile ) {
         std::cout << "[ERROR] Unable to open the input file(s)." ;
         std::cout << std::endl;
         return ;
     }
 
-    std::string resultDir = "..\\test\\result_child_" + getTimeStamp();
-    const char *path = resultDir.c_str();
-    int check = mkdir(path);
-    if (check) {
+    std::string resultDir = TEST_DIR + "result_child_" + getTimeStamp();
+    if (makeDirectory(resultDir)) {
         std::cout << "[ERROR] Unable to create the result directory." ;
         std::cout << std::endl;
         return ;
@@ -161,7 +170,7 @@ void childTest() {
     int fenCounter = 1;
 
     while(getline(testFile, rootFen)) {
-        std::string resultName = resultDir + "\\fen_" + std::to_string(fenCounter) + ".csv";
+        std::string resultName = resultDir + "/fen_" + std::to_string(fenCounter) + ".csv";
         resultFile.open(resultName);
 
         resultFile << "move1,move2,"
@@ -169,34 +178,34 @@ void childTest() {
                    << "REC_LEGAL_MOVES,EXPANDABLE_STATES,REC_EXPANDABLE_STATES,"
                    << "trap\n";
 
-        Position *rootPos  = new Position(rootFen, false, 0);
-        if (rootPos->get_key()==0) continue;
+        Position rootPos(rootFen, false, 0);
+        if (rootPos.get_key()==0) continue;
 
         // print first row - the root position itself
-        resultFile << "root,root,1,1,1,1,1,1,1," << (isTrap(rootPos) ? 1 : 0) << std::endl;
+        resultFile << "root,root,1,1,1,1,1,1,1," << (isTrap(&rootPos) ? 1 : 0) << std::endl;
 
         StateInfo st1, st2;
-        std::vector<MoveStack> moves = getMoves(rootPos);
+        std::vector<MoveStack> moves = getMoves(&rootPos);
         if (moves.empty()) continue;
 
         // iterate over all grand-children to analyse trap existence in correspondence to similairty measures
         for (MoveStack ms : moves) {
 
-            Position *childPos  = new Position(*rootPos, rootPos->thread());        // calculate child position
-            childPos->do_move(ms.move, st1);
-            std::vector<MoveStack> childMoves = getMoves(childPos);
+            Position childPos(rootPos, rootPos.thread());         // calculate child position
+            childPos.do_move(ms.move, st1);
+            std::vector<MoveStack> childMoves = getMoves(&childPos);
 
             for (MoveStack cms : childMoves) {
 
-                Position *grandPos  = new Position(*childPos, childPos->thread());  // calculate grandchild position
-                grandPos->do_move(cms.move, st2);
+                Position grandPos(childPos, childPos.thread());   // calculate grandchild position
+                grandPos.do_move(cms.move, st2);
                 resultFile << move_to_uci(ms.move, false) << "," << move_to_uci(cms.move, false) << ",";
 
                 for (int i = CONSTANT; i <= REC_EXPANDABLE_STATES; i++) {
-                    sim = simFromKey(i, grandPos, rootPos);
+                    sim = simFromKey(i, &grandPos, &rootPos);
                     resultFile << std::to_string(sim) + ",";
                 }
-                resultFile << (isTrap(grandPos) ? 1 : 0) << std::endl;
+                resultFile << (isTrap(&grandPos) ? 1 : 0) << std::endl;
             }
         }
         fenCounter++;
@@ -207,8 +216,7 @@ void childTest() {
 }
 
 /**
- * Due to inability to use variable templates, this wrapper method is used to correctly call the
- * similarityFen<SimMethod>() where SimMethod is the key of the method to use.
+ * Call the similarity method of a given key through the dispatch table @SimMethods.
  * @param key the unique key of a similairty method
  * @param pos1 the first position
  * @param pos2 the second position
@@ -220,39 +228,16 @@ double simFromKey(int key, Position *pos1, Position *pos2) {
         return sim;
     }
 
-    switch (key) {
-        case 0:
-            sim = similarity<CONSTANT>(pos1, pos2);
-            break;
-        case 1:
-            sim = similarity<DEPTH_BREADTH>(pos1, pos2);
-            break;
-        case 2:
-            sim = similarity<INFL_PIECES>(pos1, pos2);
-            break;
-        case 3:
-            sim = similarity<LEGAL_MOVES>(pos1, pos2);
-            break;
-        case 4:
-            sim = similarity<REC_LEGAL_MOVES>(pos1, pos2);
-            break;
-        case 5:
-            sim = similarity<EXPANDABLE_STATES>(pos1, pos2);
-            break;
-        case 6:
-//            sim = similarity<REC_EXPANDABLE_STATES>(pos1, pos2);
-            break;
-        default:;
-    }
+    if (key >= CONSTANT && key < SIM_METHOD_NB)
+        sim = SimMethods[key].similarity(pos1, pos2);
 
     return sim;
 }
 
 double simFromKey(int key, std::string fen1, std::string fen2) {
-    Position *pos1 = new Position(fen1, false, 0),
-            *pos2 = new Position(fen2, false, 0);
+    Position pos1(fen1, false, 0), pos2(fen2, false, 0);
 
-    return simFromKey(key, pos1, pos2);
+    return simFromKey(key, &pos1, &pos2);
 }
 
 /**
@@ -274,6 +259,19 @@ std::string getTimeStamp() {
     return ts;
 }
 
+/**
+ * Creates a directory, with the call of the platform the engine is built for.
+ * @param path path of the new directory
+ * @return 0 on success, non-zero otherwise
+ */
+int makeDirectory(const std::string& path) {
+#if defined(_WIN32)
+    return _mkdir(path.c_str());
+#else
+    return mkdir(path.c_str(), 0755);
+#endif
+}
+
 /**
  * Evaluates trap persistence between two board positions.
  * @param pos1 the first position
@@ -289,52 +287,385 @@ std::string trapPersistence(Position *pos1, Position *pos2) {
 }
 
 std::string trapPersistence(std::string fen1, std::string fen2) {
-    Position *pos1 = new Position(fen1, false, 0),
-             *pos2 = new Position(fen2, false, 0);
+    Position pos1(fen1, false, 0), pos2(fen2, false, 0);
 
-    return trapPersistence(pos1, pos2);
+    return trapPersistence(&pos1, &pos2);
+}
+
+///////////////////////////////////////////////////
+/// TRAP DETECTION
+///////////////////////////////////////////////////
+namespace {
+
+    /**
+     * Node types of the trap search, salted into the position keys of the transposition cache.
+     */
+    const Key MATE_IN_ONE_NODE = 0x5bd1e9955bd1e995ULL,
+              ALL_MATED_NODE   = 0xc6a4a7935bd1e995ULL;
+
+    /**
+     * Entry of the transposition cache of the trap search. The result is stored together with its key xor-ed with
+     * the result, so an entry torn by two threads writing at once fails the key check.
+     */
+    struct TrapEntry {
+        volatile uint64_t check, data;
+    };
+
+    TrapEntry trapCache[TRAP_CACHE_SIZE];
+
+    bool trapProbe(Key key, bool& result) {
+        const TrapEntry& e = trapCache[key & (TRAP_CACHE_SIZE - 1)];
+        uint64_t data = e.data, check = e.check;
+
+        if ((check ^ data) != key)
+            return false;
+
+        result = (data != 0);
+        return true;
+    }
+
+    bool trapStore(Key key, bool result) {
+        TrapEntry& e = trapCache[key & (TRAP_CACHE_SIZE - 1)];
+        e.data = result;
+        e.check = key ^ uint64_t(result);
+        return result;
+    }
+
+    /**
+     * Order the moves of a list with the checking moves first, then the captures, keeping the order of the rest.
+     * Return the end of the checking moves.
+     */
+    MoveStack* orderChecksFirst(Position* pos, MoveStack* mlist, MoveStack* last, const CheckInfo& ci) {
+        MoveStack* checks = std::stable_partition(mlist, last, [&](const MoveStack& m) {
+            return pos->move_gives_check(m.move, ci);
+        });
+        std::stable_partition(checks, last, [&](const MoveStack& m) {
+            return pos->move_is_capture(m.move);
+        });
+        return checks;
+    }
+
+    /**
+     * Check whether the side to move has a mate in one. Only checking moves can mate, so the others are not tried.
+     */
+    bool hasMateInOne(Position* pos) {
+        bool result;
+        Key key = pos->get_key() ^ MATE_IN_ONE_NODE;
+        if (trapProbe(key, result))
+            return result;
+
+        MoveStack mlist[MAX_MOVES];
+        MoveStack *last = generate<MV_LEGAL>(*pos, mlist);
+        CheckInfo ci(*pos);
+        StateInfo st;
+
+        for (MoveStack* cur = mlist; cur != last; cur++) {
+            if (!pos->move_gives_check(cur->move, ci))
+                continue;
+
+            pos->do_move(cur->move, st, ci, true);
+            bool mate = pos->is_mate();
+            pos->undo_move(cur->move);
+            if (mate)
+                return trapStore(key, true);
+        }
+        return trapStore(key, false);
+    }
+
+    /**
+     * AND node: check whether the side to move has at least one move and every one of its moves allows a mate in one.
+     * The search stops at the first defence.
+     */
+    bool allRepliesMated(Position* pos) {
+        bool result;
+        Key key = pos->get_key() ^ ALL_MATED_NODE;
+        if (trapProbe(key, result))
+            return result;
+
+        MoveStack mlist[MAX_MOVES];
+        MoveStack *last = generate<MV_LEGAL>(*pos, mlist);
+        CheckInfo ci(*pos);
+        StateInfo st;
+
+        if (last == mlist)
+            return trapStore(key, false);
+
+        for (MoveStack* cur = mlist; cur != last; cur++) {
+            pos->do_move(cur->move, st, ci, pos->move_gives_check(cur->move, ci));
+            bool mated = hasMateInOne(pos);
+            pos->undo_move(cur->move);
+            if (!mated)
+                return trapStore(key, false);
+        }
+        return trapStore(key, true);
+    }
+
+    /**
+     * OR node: check whether the side to move has a move after which every reply allows a mate in one. Checking
+     * moves and captures are tried first as they are the most likely to force the mate.
+     */
+    bool hasMateInTwo(Position* pos) {
+        MoveStack mlist[MAX_MOVES];
+        MoveStack *last = generate<MV_LEGAL>(*pos, mlist);
+        CheckInfo ci(*pos);
+        StateInfo st;
+
+        MoveStack* checks = orderChecksFirst(pos, mlist, last, ci);
+        for (MoveStack* cur = mlist; cur != last; cur++) {
+            pos->do_move(cur->move, st, ci, cur < checks);
+            bool won = allRepliesMated(pos);
+            pos->undo_move(cur->move);
+            if (won)
+                return true;
+        }
+        return false;
+    }
 }
 
 /**
- * Checks whether any of the moves of the agent leads to a 2-winning strategy for the opponent.
- * @param fen position stored in a FEN string
+ * Checks whether any of the moves of the agent leads to a 2-winning strategy for the opponent, i.e. a move after
+ * which the opponent has a move that leaves the agent only replies allowing a mate in one. Bounded AND/OR mate search
+ * with cutoffs at the first proof or refutation and a transposition cache shared by all calls.
+ * @param pos position with the agent to move
  * @return true if the trap is present, false otherwise
  */
 bool isTrap(Position *pos) {
-    StateInfo st, st2, st3, st4;
-    std::vector<MoveStack> us_1_v = getMoves(pos);
-
-    for (MoveStack us_1 : us_1_v) { // examine if any of our moves leads to a 3 move win for the opponent
-        pos->do_move(us_1.move, st);
-        std::vector<MoveStack> op_2_v = getMoves(pos);
-
-        for (MoveStack op_2 : op_2_v) {
-            pos->do_move(op_2.move, st2);
-            std::vector<MoveStack> us_3_v = getMoves(pos);
-
-            int trapCount = 0;
-            for (MoveStack us_3 : us_3_v) {
-                pos->do_move(us_3.move, st3);
-                std::vector<MoveStack> op_4_v = getMoves(pos);
-
-                for (MoveStack op_4 : op_4_v) {
-                    pos->do_move(op_4.move, st4);
-                    if (pos->is_mate()) {
-                        trapCount++;
-                        pos->undo_move(op_4.move); break;
-                    }
-                    pos->undo_move(op_4.move);
-                }
-                pos->undo_move(us_3.move);
-            }
-            if (!us_3_v.empty() && us_3_v.size() == trapCount) {
-                pos->undo_move(op_2.move);
-                pos->undo_move(us_1.move);
-                return true;    // regardless of our move the opponent wins
-            }
-            pos->undo_move(op_2.move);
-        }
-        pos->undo_move(us_1.move);
+    MoveStack mlist[MAX_MOVES];
+    MoveStack *last = generate<MV_LEGAL>(*pos, mlist);
+    CheckInfo ci(*pos);
+    StateInfo st;
+
+    for (MoveStack* cur = mlist; cur != last; cur++) {
+        pos->do_move(cur->move, st, ci, pos->move_gives_check(cur->move, ci));
+        bool trapped = hasMateInTwo(pos);
+        pos->undo_move(cur->move);
+        if (trapped)
+            return true;
     }
     return false;
-}
\ No newline at end of file
+}
+
+/**
+ * Check @isTrap() against a file of labelled positions, one per line: a FEN string followed by ";trap 1" if the
+ * position is a trap or ";trap 0" if it is not. Every mismatch and malformed line is reported.
+ * @param fileName path of the labelled positions
+ * @return true if all the labels match
+ */
+bool trapSuite(const std::string& fileName) {
+    std::ifstream suite(fileName.c_str());
+    if (!suite.is_open()) {
+        std::cerr << "Unable to open trap suite " << fileName << std::endl;
+        return false;
+    }
+
+    std::string line, tag;
+    int positions = 0, failures = 0, expected;
+
+    while (std::getline(suite, line)) {
+        if (line.empty())
+            continue;
+
+        positions++;
+        size_t sep = line.find(';');
+        std::string fen = line.substr(0, line.find_last_not_of(' ', sep - 1) + 1);
+        std::istringstream label(sep == std::string::npos ? "" : line.substr(sep));
+
+        Position pos(fen, false, 0);
+        if (!(label >> tag >> expected) || tag != ";trap" || pos.get_key() == 0 || !pos.is_ok()) {
+            failures++;
+            std::cout << "Malformed line " << line << std::endl;
+            continue;
+        }
+
+        bool trap = isTrap(&pos);
+        if (trap != (expected != 0)) {
+            failures++;
+            std::cout << "Trap of " << fen << ": found " << trap << ", expected " << expected << std::endl;
+        }
+    }
+
+    std::cout << "\nPositions       : " << positions
+              << "\nFailures        : " << failures << std::endl;
+
+    return failures == 0;
+}
+
+///////////////////////////////////////////////////
+/// BATCH EVALUATION
+///////////////////////////////////////////////////
+namespace {
+
+    /**
+     * Share of a chunk of FEN pairs evaluated by a single worker. Workers take the pairs one by one, so a worker stuck
+     * on an expensive pair does not hold back the others.
+     */
+    struct BatchJob {
+        const std::vector<std::string>* pairs;
+        std::vector<std::string>* rows;
+        volatile int* next;
+        Lock* lock;
+        int threadID;
+    };
+
+    /**
+     * CSV row of a line that is not a valid FEN pair, an empty line included: every similarity is @INVALID_FEN, so that
+     * a bad line does not stop the batch and the rows stay aligned with the input lines.
+     */
+    std::string errorRow() {
+        std::string row;
+        char value[32];
+
+        for (int key = CONSTANT; key < SIM_METHOD_NB; key++) {
+            snprintf(value, sizeof(value), "%f,", INVALID_FEN);
+            row += value;
+        }
+        return row + "error";
+    }
+
+    /**
+     * Evaluate all the similarity methods and the trap persistence of a line "fen1,fen2" into a CSV row.
+     */
+    std::string evaluatePair(const std::string& pair, int threadID) {
+        size_t comma = pair.find(',');
+        if (comma == std::string::npos)
+            return errorRow();
+
+        Position pos1(pair.substr(0, comma), false, threadID), pos2(pair.substr(comma + 1), false, threadID);
+        if (pos1.get_key() == 0 || pos2.get_key() == 0 || !pos1.is_ok() || !pos2.is_ok())
+            return errorRow();
+
+        std::string row;
+        char value[32];
+
+        for (int key = CONSTANT; key < SIM_METHOD_NB; key++) {
+            snprintf(value, sizeof(value), "%f,", simFromKey(key, &pos1, &pos2));
+            row += value;
+        }
+        row += trapPersistence(&pos1, &pos2);
+        return row;
+    }
+
+    void runBatchJob(BatchJob* job) {
+        while (true) {
+            lock_grab(job->lock);
+            int i = (*job->next)++;
+            lock_release(job->lock);
+
+            if (i >= (int)job->pairs->size())
+                break;
+            (*job->rows)[i] = evaluatePair((*job->pairs)[i], job->threadID);
+        }
+    }
+
+    extern "C" {
+
+#if defined(_MSC_VER)
+    DWORD WINAPI batch_routine(LPVOID job) {
+        runBatchJob((BatchJob*)job);
+        return 0;
+    }
+#else
+    void* batch_routine(void* job) {
+        runBatchJob((BatchJob*)job);
+        return NULL;
+    }
+#endif
+
+    }
+
+    /**
+     * Evaluate a chunk of FEN pairs on a number of threads, the calling thread included.
+     */
+    void evaluateChunk(const std::vector<std::string>& pairs, std::vector<std::string>& rows, int threads) {
+        BatchJob jobs[MAX_THREADS];
+#if defined(_MSC_VER)
+        HANDLE handles[MAX_THREADS];
+#else
+        pthread_t handles[MAX_THREADS];
+#endif
+        volatile int next = 0;
+        Lock lock;
+
+        lock_init(&lock);
+        rows.assign(pairs.size(), "");
+        for (int i = 0; i < threads; i++) {
+            jobs[i].pairs = &pairs;
+            jobs[i].rows = &rows;
+            jobs[i].next = &next;
+            jobs[i].lock = &lock;
+            jobs[i].threadID = i;
+        }
+
+        int started = 1;
+        for (; started < threads; started++) {
+#if defined(_MSC_VER)
+            handles[started] = CreateThread(NULL, 0, batch_routine, (LPVOID)&jobs[started], 0, NULL);
+            if (!handles[started])
+#else
+            if (pthread_create(&handles[started], NULL, batch_routine, (void*)&jobs[started]))
+#endif
+                break;
+        }
+
+        runBatchJob(&jobs[0]);
+
+        for (int i = 1; i < started; i++) {
+#if defined(_MSC_VER)
+            WaitForSingleObject(handles[i], INFINITE);
+            CloseHandle(handles[i]);
+#else
+            pthread_join(handles[i], NULL);
+#endif
+        }
+        lock_destroy(&lock);
+    }
+}
+
+/**
+ * Headless batch evaluation. FEN pairs are read from the input file, one "fen1,fen2" pair per line, and evaluated
+ * chunk by chunk on a pool of threads. The rows are written in the input order through a buffered writer.
+ * @param inName path of the input file
+ * @param outName path of the CSV output file
+ * @param threads number of worker threads
+ */
+void similarityBatch(const std::string& inName, const std::string& outName, int threads) {
+
+    std::ifstream inFile(inName.c_str());
+    FILE* outFile = fopen(outName.c_str(), "w");
+
+    if (!inFile || !outFile) {
+        std::cout << "[ERROR] Unable to open the required file(s)." << std::endl;
+        if (outFile)
+            fclose(outFile);
+        return;
+    }
+
+    static char buffer[1 << 20];
+    setvbuf(outFile, buffer, _IOFBF, sizeof(buffer));
+    threads = std::max(1, std::min(threads, MAX_THREADS));
+
+    fputs("CONSTANT,DEPTH_BREADTH,INFL_PIECES,LEGAL_MOVES,REC_LEGAL_MOVES,EXPANDABLE_STATES,"
+          "REC_EXPANDABLE_STATES,trap_presence\n", outFile);
+
+    std::vector<std::string> pairs, rows;
+    std::string line;
+    int count = 0, time = get_system_time();
+    bool more = true;
+
+    while (more) {
+        pairs.clear();
+        while (pairs.size() < BATCH_CHUNK_SIZE && (more = (bool)getline(inFile, line)))
+            pairs.push_back(line);
+
+        evaluateChunk(pairs, rows, threads);
+        for (size_t i = 0; i < rows.size(); i++) {
+            fputs(rows[i].c_str(), outFile);
+            fputc('\n', outFile);
+        }
+        count += pairs.size();
+    }
+    fclose(outFile);
+
+    std::cout << "[INFO] " << count << " pairs evaluated in " << get_system_time() - time
+              << " ms, results exported to: " << outName << std::endl;
+}
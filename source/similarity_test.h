@@ -13,10 +13,24 @@ const std::string EXIT_CMD   = "exit",
 
 const double INVALID_FEN = -998;        // impossible similarity value used to indicate invalid FEN positions
 
+const std::string TEST_DIR = "../test/"; // directory of the test sets and results, relative to the working directory
+const size_t BATCH_CHUNK_SIZE = 1024;   // number of FEN pairs read and evaluated at once by @similarityBatch()
+const int TRAP_CACHE_SIZE = 1 << 16;    // number of entries of the transposition cache of @isTrap() (power of two)
+
 /**
  * Method called from an UCI command to begin similairty measure testing
  */
 void similarityTest();
+
+/**
+ * Method called from the 'simbatch' command to evaluate a file of FEN pairs on a number of threads
+ */
+void similarityBatch(const std::string& inName, const std::string& outName, int threads);
 bool isTrap(Position *pos);
 
+/**
+ * Method called from the 'trapcheck' command to check @isTrap() against a file of labelled positions
+ */
+bool trapSuite(const std::string& fileName);
+
 #endif /* SIMILARITY_TEST_H_ */
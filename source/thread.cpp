@@ -139,6 +139,8 @@ void ThreadsManager::init() {
   {
       lock_init(&threads[i].sleepLock);
       cond_init(&threads[i].sleepCond);
+      lock_init(&threads[i].taskLock);
+      cond_init(&threads[i].taskCond);
 
       for (int j = 0; j < MAX_ACTIVE_SPLIT_POINTS; j++)
           lock_init(&(threads[i].splitPoints[j].lock));
@@ -188,6 +190,8 @@ void ThreadsManager::exit() {
       // Now we can safely destroy the locks and wait conditions
       lock_destroy(&threads[i].sleepLock);
       cond_destroy(&threads[i].sleepCond);
+      lock_destroy(&threads[i].taskLock);
+      cond_destroy(&threads[i].taskCond);
 
       for (int j = 0; j < MAX_ACTIVE_SPLIT_POINTS; j++)
           lock_destroy(&(threads[i].splitPoints[j].lock));
@@ -228,6 +232,47 @@ bool ThreadsManager::available_slave_exists(int master) const {
 }
 
 
+// start_task() hands a task to an idle thread, which runs it from its idle
+// loop instead of searching a split point. It returns false if the thread is
+// not available, then the caller has to run the task itself.
+
+bool ThreadsManager::start_task(int threadID, void (*task)(void*), void* data) {
+
+  assert(threadID > 0 && threadID < activeThreads);
+
+  lock_grab(&mpLock);
+
+  if (threads[threadID].state != Thread::AVAILABLE)
+  {
+      lock_release(&mpLock);
+      return false;
+  }
+
+  threads[threadID].task = task;
+  threads[threadID].taskData = data;
+  threads[threadID].state = Thread::WORKISWAITING;
+
+  lock_release(&mpLock);
+
+  threads[threadID].wake_up();
+  return true;
+}
+
+
+// wait_task() sleeps until the thread has finished the task started with
+// start_task().
+
+void ThreadsManager::wait_task(int threadID) {
+
+  lock_grab(&threads[threadID].taskLock);
+
+  while (threads[threadID].state != Thread::AVAILABLE)
+      cond_wait(&threads[threadID].taskCond, &threads[threadID].taskLock);
+
+  lock_release(&threads[threadID].taskLock);
+}
+
+
 // split() does the actual work of distributing the work at a node between
 // several available threads. If it does not succeed in splitting the
 // node (because no idle threads are available, or because we have no unused
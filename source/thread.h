@@ -84,8 +84,12 @@ struct Thread {
   int maxPly;
   Lock sleepLock;
   WaitCondition sleepCond;
+  Lock taskLock;
+  WaitCondition taskCond;
   volatile ThreadState state;
   SplitPoint* volatile splitPoint;
+  void (* volatile task)(void*);
+  void* volatile taskData;
   volatile int activeSplitPoints;
   SplitPoint splitPoints[MAX_ACTIVE_SPLIT_POINTS];
 };
@@ -113,6 +117,8 @@ public:
   void read_uci_options();
   bool available_slave_exists(int master) const;
   void idle_loop(int threadID, SplitPoint* sp);
+  bool start_task(int threadID, void (*task)(void*), void* data);
+  void wait_task(int threadID);
 
   template <bool Fake>
   void split(Position& pos, SearchStack* ss, Value* alpha, const Value beta, Value* bestValue,
@@ -0,0 +1,192 @@
+#include <algorithm>
+#include <climits>
+#include <fstream>
+#include <iostream>
+
+#include "trapindex.h"
+#include "movegen.h"
+#include "rkiss.h"
+
+TrapIndex TrapStates; // Global object
+
+namespace {
+
+    /**
+     * Coefficients of the universal hash functions of the MinHash signature, the same in every run of the engine
+     * so that signatures stay comparable.
+     */
+    struct MinHashFunctions {
+        MinHashFunctions() {
+            RKISS rk;
+            for (int i = 0; i < MINHASH_SIZE; i++) {
+                mul[i] = rk.rand<uint64_t>() | 1;
+                add[i] = rk.rand<uint64_t>();
+            }
+        }
+        uint64_t mul[MINHASH_SIZE], add[MINHASH_SIZE];
+    };
+
+    const MinHashFunctions MinHash;
+
+    /**
+     * Bucket of a band of a signature.
+     */
+    int bucketOf(const uint32_t* signature, int band) {
+        uint64_t h = 0;
+        for (int i = band * LSH_ROWS; i < (band + 1) * LSH_ROWS; i++)
+            h = (h ^ signature[i]) * 0x9E3779B97F4A7C15ULL;
+        return int(h >> 32) & (LSH_BUCKETS - 1);
+    }
+}
+
+/**
+ * Calculate the MinHash signature of the legal moves of a position. A position without legal moves gets the signature
+ * of the empty set, which matches only other empty sets.
+ * @param pos position to be signed
+ * @param signature array of MINHASH_SIZE values to be filled
+ */
+void minhash(Position* pos, uint32_t* signature) {
+
+    MoveStack mlist[MAX_MOVES];
+    MoveStack* last = generate<MV_LEGAL>(*pos, mlist);
+
+    for (int i = 0; i < MINHASH_SIZE; i++) {
+        uint32_t minValue = UINT_MAX;
+        for (MoveStack* cur = mlist; cur != last; cur++)
+            minValue = std::min(minValue, uint32_t((uint64_t(cur->move) * MinHash.mul[i] + MinHash.add[i]) >> 32));
+        signature[i] = minValue;
+    }
+}
+
+/**
+ * Estimate the similarity of two positions from their MinHash signatures.
+ * @param s1 signature of the first position
+ * @param s2 signature of the second position
+ * @return estimated similarity (real number between 0 and 1 inclusive)
+ */
+double minhashSimilarity(const uint32_t* s1, const uint32_t* s2) {
+
+    int equal = 0;
+    for (int i = 0; i < MINHASH_SIZE; i++)
+        equal += (s1[i] == s2[i]);
+    return double(equal) / MINHASH_SIZE;
+}
+
+TrapIndex::TrapIndex() {}
+
+/**
+ * Remove all the indexed trap states.
+ */
+void TrapIndex::clear() {
+
+    states.clear();
+    for (int band = 0; band < LSH_BANDS; band++)
+        for (int b = 0; b < LSH_BUCKETS; b++)
+            buckets[band][b].clear();
+    corpusName = "";
+}
+
+/**
+ * Replace the indexed trap states by a corpus of trap positions, one FEN string per line. Malformed FEN strings and
+ * positions without trap moves are skipped.
+ * @param fileName path of the corpus
+ * @return true if the corpus could be read
+ */
+bool TrapIndex::load(const std::string& fileName) {
+
+    clear();
+    corpusName = fileName;
+
+    std::ifstream corpus(fileName.c_str());
+    if (!corpus.is_open()) {
+        std::cerr << "Failed to open trap corpus " << fileName << std::endl;
+        return false;
+    }
+
+    std::string fen;
+    MoveStack traps[MAX_MOVES];
+    int lineNumber = 0;
+    while (std::getline(corpus, fen)) {
+        lineNumber++;
+        if (fen.empty())
+            continue;
+
+        Position pos(fen, false, 0);
+        if (pos.get_key() == 0 || !pos.is_ok()) {
+            std::cerr << "Skipping malformed FEN on line " << lineNumber << " of " << fileName << std::endl;
+            continue;
+        }
+        MoveStack* lastTrap = generate<TRAP>(&pos, traps);
+        insert(&pos, traps, lastTrap);
+    }
+    return true;
+}
+
+/**
+ * Index a position together with its trap moves. Positions without trap moves or indexed already are skipped.
+ * @param pos position to be indexed
+ * @param traps first trap move of the position
+ * @param lastTrap end of the trap moves of the position
+ */
+void TrapIndex::insert(Position* pos, const MoveStack* traps, const MoveStack* lastTrap) {
+
+    if (traps == lastTrap)
+        return;
+
+    TrapState s;
+    s.key = pos->get_key();
+    s.side = pos->side_to_move();
+    s.trapCount = 0;
+    minhash(pos, s.signature);
+
+    const std::vector<int>& sameBucket = buckets[0][bucketOf(s.signature, 0)];
+    for (size_t i = 0; i < sameBucket.size(); i++)
+        if (states[sameBucket[i]].key == s.key)
+            return;
+
+    for (const MoveStack* cur = traps; cur != lastTrap && s.trapCount < MAX_TRAPS; cur++)
+        s.traps[s.trapCount++] = cur->move;
+
+    for (int band = 0; band < LSH_BANDS; band++)
+        buckets[band][bucketOf(s.signature, band)].push_back(int(states.size()));
+    states.push_back(s);
+}
+
+/**
+ * Find the indexed trap state most similar to a position with the same side to move. Only the states sharing at least
+ * one band bucket with the position are compared.
+ * @param pos position to be looked up
+ * @param sim estimated similarity of the found state, left unchanged if none is found
+ * @return most similar trap state or NULL if no candidate is found
+ */
+const TrapState* TrapIndex::nearest(Position* pos, double& sim) const {
+
+    uint32_t signature[MINHASH_SIZE];
+    std::vector<int> candidates;
+
+    minhash(pos, signature);
+    for (int band = 0; band < LSH_BANDS; band++) {
+        const std::vector<int>& bucket = buckets[band][bucketOf(signature, band)];
+        candidates.insert(candidates.end(), bucket.begin(), bucket.end());
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    const TrapState* best = NULL;
+    double bestSim = -1;
+    for (size_t i = 0; i < candidates.size(); i++) {
+        const TrapState& s = states[candidates[i]];
+        if (s.side != pos->side_to_move())
+            continue;
+
+        double candidateSim = minhashSimilarity(signature, s.signature);
+        if (candidateSim > bestSim) {
+            bestSim = candidateSim;
+            best = &s;
+        }
+    }
+
+    if (best)
+        sim = bestSim;
+    return best;
+}
@@ -0,0 +1,66 @@
+#include <string>
+#include <vector>
+
+#include "position.h"
+#include "move.h"
+
+#ifndef TRAPINDEX_H_
+#define TRAPINDEX_H_
+
+/** Constants **/
+const int MINHASH_SIZE = 32,         // number of hash functions of a MinHash signature
+          LSH_BANDS    = 8,          // number of bands the signature is split into for locality sensitive hashing
+          LSH_ROWS     = MINHASH_SIZE / LSH_BANDS, // signature values per band
+          LSH_BUCKETS  = 1 << 12,    // number of buckets of each band (power of two)
+          MAX_TRAPS    = 16;         // maximal number of trap moves recorded for an indexed position
+
+/**
+ * Known trap state: the MinHash signature of the legal moves of a position together with its trap moves.
+ */
+struct TrapState {
+    Key key;
+    Color side;
+    uint32_t signature[MINHASH_SIZE];
+    Move traps[MAX_TRAPS];
+    int trapCount;
+};
+
+/**
+ * Calculate the MinHash signature of the legal moves of a position. The share of equal values of two signatures
+ * estimates the intersection-to-union ratio of the move sets, i.e. @similarity<LEGAL_MOVES>().
+ * @param pos position to be signed
+ * @param signature array of MINHASH_SIZE values to be filled
+ */
+void minhash(Position* pos, uint32_t* signature);
+
+/**
+ * Estimate the similarity of two positions from their MinHash signatures.
+ * @param s1 signature of the first position
+ * @param s2 signature of the second position
+ * @return estimated similarity (real number between 0 and 1 inclusive)
+ */
+double minhashSimilarity(const uint32_t* s1, const uint32_t* s2);
+
+/**
+ * Index of the trap states seen in the game or loaded from a corpus of trap positions. The signatures are bucketed
+ * band by band, so only the states sharing a band with the queried position are compared.
+ */
+class TrapIndex {
+public:
+    TrapIndex();
+    void clear();
+    bool load(const std::string& fileName);
+    void insert(Position* pos, const MoveStack* traps, const MoveStack* lastTrap);
+    const TrapState* nearest(Position* pos, double& sim) const;
+    const std::string name() const { return corpusName; }
+    int size() const { return int(states.size()); }
+
+private:
+    std::vector<TrapState> states;
+    std::vector<int> buckets[LSH_BANDS][LSH_BUCKETS];
+    std::string corpusName;
+};
+
+extern TrapIndex TrapStates;
+
+#endif /* TRAPINDEX_H_ */
@@ -68,6 +68,9 @@ typedef unsigned __int64 uint64_t;
 ////                | Works only in 64-bit mode. For compiling requires hardware
 ////                | with popcnt support. Around 4% speed-up.
 ////
+//// -DUSE_PEXT     | Add runtime support for use of pext asm-instruction (BMI2)
+////                | to index the slider attack tables. Works only in 64-bit mode.
+////
 //// -DOLD_LOCKS    | By default under Windows are used the fast Slim Reader/Writer (SRW)
 ////                | Locks and Condition Variables: these are not supported by Windows XP
 ////                | and older, to compile for those platforms you should enable OLD_LOCKS.
@@ -144,6 +147,41 @@ const bool CpuHasPOPCNT = cpu_has_popcnt();
 const bool CpuHasPOPCNT = false;
 #endif
 
+/// cpu_has_pext() detects support for a fast pext instruction (BMI2) at
+/// runtime. AMD processors before Zen 3 (family 19h) run pext in microcode,
+/// slower than a magic multiplication, so they are reported as without it.
+inline bool cpu_has_pext() {
+
+  int CPUInfo[4] = {-1};
+  __cpuid(CPUInfo, 0x00000000);
+
+  if (CPUInfo[0] < 7)
+      return false;
+
+  bool isAMD = (CPUInfo[1] == 0x68747541); // "Auth" of "AuthenticAMD"
+
+  __cpuid(CPUInfo, 0x00000001);
+  int family = (CPUInfo[0] >> 8) & 0xF;
+  if (family == 0xF)
+      family += (CPUInfo[0] >> 20) & 0xFF;
+
+  if (isAMD && family < 0x19)
+      return false;
+
+  __cpuid(CPUInfo, 0x00000007);
+  return (CPUInfo[1] >> 8) & 1;
+}
+
+/// CpuHasPEXT is a global constant initialized at startup that is set
+/// to true if CPU on which application runs has a fast pext hardware
+/// instruction. Unless USE_PEXT is not defined. It is defined once in
+/// bitboard.cpp, so that the detection runs a single time.
+#if defined(USE_PEXT)
+extern const bool CpuHasPEXT;
+#else
+const bool CpuHasPEXT = false;
+#endif
+
 
 /// CpuIs64Bit is a global constant initialized at compile time that
 /// is set to true if CPU on which application runs is a 64 bits.
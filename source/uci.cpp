@@ -29,6 +29,7 @@
 #include "search.h"
 #include "ucioption.h"
 #include "uctsearch.h"
+#include "similarity.h"
 #include "similarity_test.h"
 
 using namespace std;
@@ -45,9 +46,13 @@ namespace {
   void set_option(UCIParser& up);
   void set_position(Position& pos, UCIParser& up);
   bool go(Position& pos, UCIParser& up);
-  void perft(Position& pos, UCIParser& up);
+  void perft(Position& pos, UCIParser& up, bool divide);
+  void perft_suite(UCIParser& up);
+  void simbatch(UCIParser& up);
 }
 
+extern bool perft_suite(const string& fileName, int maxDepth);
+
 
 /// execute_uci_command() takes a string as input, uses a UCIParser
 /// object to parse this text string as a UCI command, and calls
@@ -82,7 +87,13 @@ bool execute_uci_command(const string& cmd) {
       set_option(up);
 
   else if (token == "perft")
-      perft(pos, up);
+      perft(pos, up, false);
+
+  else if (token == "divide")
+      perft(pos, up, true);
+
+  else if (token == "perftsuite")
+      perft_suite(up);
 
   else if (token == "d")
       pos.print();
@@ -110,9 +121,19 @@ bool execute_uci_command(const string& cmd) {
   else if (token == "trap")
       cout << (isTrap(&pos) ? "trap found" : "no trap") << endl;
 
+  else if (token == "trapcheck")
+  {
+      string fileName = TEST_DIR + "trap_suite.in";
+      up >> fileName;
+      trapSuite(fileName);
+  }
+
   else if (token == "sim")
       similarityTest();
 
+  else if (token == "simbatch")
+      simbatch(up);
+
   else
       cout << "Unknown command: " << cmd << endl;
 
@@ -232,11 +253,12 @@ namespace {
   }
 
 
-  // perft() is called when engine receives the "perft" command.
-  // The function calls perft() passing the required search depth
-  // then prints counted leaf nodes and elapsed time.
+  // perft() is called when engine receives the "perft" or "divide" command.
+  // The function calls perft() passing the required search depth and the
+  // number of threads, then prints counted leaf nodes and elapsed time.
+  // With "divide" the leaf nodes under each root move are printed first.
 
-  void perft(Position& pos, UCIParser& up) {
+  void perft(Position& pos, UCIParser& up, bool divide) {
 
     int depth, time;
     int64_t n;
@@ -246,7 +268,7 @@ namespace {
 
     time = get_system_time();
 
-    n = perft(pos, depth * ONE_PLY);
+    n = perft(pos, depth * ONE_PLY, Options["Threads"].value<int>(), divide);
 
     time = get_system_time() - time;
 
@@ -254,4 +276,39 @@ namespace {
               << "\nTime (ms) " << time
               << "\nNodes/second " << int(n / (time / 1000.0)) << std::endl;
   }
+
+
+  // perft_suite() is called when engine receives the "perftsuite" command,
+  // optionally followed by the maximal depth and the suite file. It checks
+  // the perft counts of the suite, by default the one of the test directory.
+
+  void perft_suite(UCIParser& up) {
+
+    int maxDepth;
+    string fileName = TEST_DIR + "perft_suite.in";
+
+    if (!(up >> maxDepth))
+        maxDepth = PLY_MAX;
+    else
+        up >> fileName;
+
+    ::perft_suite(fileName, maxDepth);
+  }
+
+
+  // simbatch() is called when engine receives the "simbatch" command. It
+  // evaluates the FEN pairs of the input file into a CSV output file, by
+  // default on as many threads as there are cores, with the recursion depth
+  // set by the "Similarity Depth" option.
+
+  void simbatch(UCIParser& up) {
+
+    string in, out, threads;
+
+    if (!(up >> in >> out))
+        return;
+
+    setSimilarityDepth(Options["Similarity Depth"].value<int>());
+    similarityBatch(in, out, up >> threads ? atoi(threads.c_str()) : cpu_count());
+  }
 }
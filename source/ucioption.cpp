@@ -22,6 +22,7 @@
 #include <sstream>
 
 #include "misc.h"
+#include "similarity.h"
 #include "thread.h"
 #include "ucioption.h"
 
@@ -95,6 +96,19 @@ OptionsMap::OptionsMap() {
   o["Minimum Thinking Time"] = UCIOption(20, 0, 5000);
   o["UCI_Chess960"] = UCIOption(false);
   o["UCI_AnalyseMode"] = UCIOption(false);
+  o["Random Seed"] = UCIOption(0, 0, INT_MAX);
+  o["Playouts Per Leaf"] = UCIOption(1, 1, 64);
+  o["Playout Cache"] = UCIOption(false);
+  o["Implicit Minimax Weight"] = UCIOption(0, 0, 100);
+  o["Trap Index"] = UCIOption(false);
+  o["Trap Corpus"] = UCIOption("");
+  o["Similarity Budget"] = UCIOption(0, 0, 1000000);
+  o["Similarity Depth"] = UCIOption(1, 1, REC_MAX_DEPTH);
+
+  string simMethods = "var Auto";
+  for (int i = 0; i < SIM_METHOD_NB; i++)
+      simMethods += string(" var ") + SimMethods[i].name;
+  o["Similarity Method"] = UCIOption("LegalMoves", simMethods.c_str());
 
   // Set some SMP parameters accordingly to the detected CPU count
   UCIOption& thr = o["Threads"];
@@ -127,6 +141,9 @@ string OptionsMap::print_all() const {
               if (o.type == "spin")
                   s << " min " << o.minValue << " max " << o.maxValue;
 
+              if (o.type == "combo")
+                  s << " " << o.comboValues;
+
               break;
           }
   return s.str();
@@ -144,6 +161,9 @@ UCIOption::UCIOption(bool def, string t) : type(t), minValue(0), maxValue(0), id
 UCIOption::UCIOption(int def, int minv, int maxv) : type("spin"), minValue(minv), maxValue(maxv), idx(Options.size())
 { defaultValue = currentValue = stringify(def); }
 
+UCIOption::UCIOption(const char* def, const char* vars) : type("combo"), comboValues(vars), minValue(0), maxValue(0), idx(Options.size())
+{ defaultValue = currentValue = def; }
+
 
 /// set_value() updates currentValue of the Option object. Normally it's up to
 /// the GUI to check for option's limits, but we could receive the new value
@@ -166,5 +186,9 @@ void UCIOption::set_value(const string& v) {
           return;
   }
 
+  // A combo value must be one of the "var" entries
+  if (type == "combo" && (" " + comboValues + " ").find(" var " + v + " ") == string::npos)
+      return;
+
   currentValue = v;
 }
@@ -31,6 +31,7 @@ public:
   UCIOption(const char* defaultValue);
   UCIOption(bool defaultValue, std::string type = "check");
   UCIOption(int defaultValue, int minValue, int maxValue);
+  UCIOption(const char* defaultValue, const char* comboValues);
 
   void set_value(const std::string& v);
   template<typename T> T value() const;
@@ -38,7 +39,7 @@ public:
 private:
   friend class OptionsMap;
 
-  std::string defaultValue, currentValue, type;
+  std::string defaultValue, currentValue, type, comboValues;
   int minValue, maxValue;
   size_t idx;
 };
@@ -71,7 +72,7 @@ T UCIOption::value() const {
 template<>
 inline std::string UCIOption::value<std::string>() const {
 
-  assert(type == "string");
+  assert(type == "string" || type == "combo");
   return currentValue;
 }
 
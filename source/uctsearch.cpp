@@ -15,7 +15,11 @@
 #include "movegen.h"
 #include "move.h"
 
+#include "lock.h"
 #include "similarity.h"
+#include "thread.h"
+#include "trapindex.h"
+#include "uctsearch.h"
 
 using namespace std;
 
@@ -26,14 +30,80 @@ namespace {
 	int depth;
 	int UCIMultiPV;
 	unsigned int iterations;
+	uint64_t randomSeed;
+	int playoutsPerLeaf;
+	int simBudget;
+	SimMethod simMethod;
 
 	// Trap Adaptiveness
-	Position *prevPosBlanc, *prevPosNoir;
+	MoveStack trapMoves[MAX_MOVES];
+	MoveStack *lastTrapMove = trapMoves;
+
+	// A root of the game, reduced to what the similarity needs: the board
+	// as a FEN string, its key and legal moves.
+	struct RootRecord {
+		Key key;
+		string fen;
+		MoveSet moves;
+	};
+
+	// Fixed capacity ring buffer of the last roots of one side. The oldest
+	// root is overwritten once the buffer is full.
+	class RootHistory {
+	public:
+		RootHistory() : count(0) {}
+
+		void push(Position& pos) {
+			RootRecord& r = records[count++ % ROOT_HISTORY_SIZE];
+			std::ostringstream fen;
+			fen << pos.to_fen() << " 0 " << pos.startpos_ply_counter() / 2 + 1;
+			r.key = pos.get_key();
+			r.fen = fen.str();
+			r.moves = MoveSet(&pos);
+		}
+
+		RootRecord* last() { return count ? &records[(count - 1) % ROOT_HISTORY_SIZE] : NULL; }
+
+	private:
+		static const int ROOT_HISTORY_SIZE = 8;
+		RootRecord records[ROOT_HISTORY_SIZE];
+		int count;
+	};
+
+	RootHistory rootHistory[2];
+
+	// Similarity of a root to the previous root of the same side, and trap
+	// moves of the root, found by a helper thread. The root is a copy owned
+	// by the baseline.
+	struct Baseline {
+		Position *root;
+		RootRecord reference;
+		bool hasReference;
+		SimMethod method;
+		int depth;
+		SimEstimate estimate;
+		MoveStack traps[MAX_MOVES];
+		MoveStack *lastTrap;
+		bool running;
+		volatile bool ready;
+		Lock lock;
+#if defined(_MSC_VER)
+		HANDLE handle;
+#else
+		pthread_t handle;
+#endif
+	};
+
+	// The baseline of the current root, and the baselines left running by
+	// a wrong guess of the next root, which are joined once they finish.
+	Baseline *baseline;
+	std::vector<Baseline*> staleBaselines;
 
 	// Time Management
 	int searchStartTime;
 	int thinkingTime;
 	const int timeRate = 20;
+	const int simTimeShare = 100; // share of the thinking time given to the similarity
 
 	// current_search_time() returns the number of milliseconds which have passed
 	// since the beginning of the current search.
@@ -79,17 +149,202 @@ namespace {
 			}
 		}
 
-		// Stop if we have no thinking time left
-		if (!Limits.infinite && current_search_time() >= thinkingTime) {
+		// Stop if we have no thinking time left (a node limit replaces the clock)
+		if (!Limits.infinite && !Limits.maxNodes && current_search_time() >= thinkingTime) {
 			StopRequest = true;
 			Limits.ponder = false;
 		}
 	}
 }
 
+namespace {
+
+	void find_baseline(Baseline *b) {
+		if (!b->hasReference)
+			b->estimate = SimMethods[b->method].sampled(b->root, NULL, simBudget);
+
+		else if (b->method == LEGAL_MOVES) {
+			// The reference is compared through its stored legal moves
+			b->estimate.sim = b->estimate.low = b->estimate.high = similarity(MoveSet(b->root), b->reference.moves);
+			b->estimate.samples = b->estimate.total = 0;
+		}
+		else {
+			Position reference(b->reference.fen, false, b->root->thread());
+			b->estimate = SimMethods[b->method].sampled(b->root, &reference, simBudget);
+		}
+
+		// The trap moves of the root do not change during the search, so
+		// find them once instead of at every trap met by a playout.
+		b->lastTrap = generate<TRAP>(b->root, b->traps);
+
+		lock_grab(&b->lock);
+		b->ready = true;
+		lock_release(&b->lock);
+	}
+
+	extern "C" {
+
+#if defined(_MSC_VER)
+	DWORD WINAPI baseline_routine(LPVOID b) {
+		find_baseline((Baseline*)b);
+		return 0;
+	}
+#else
+	void* baseline_routine(void* b) {
+		find_baseline((Baseline*)b);
+		return NULL;
+	}
+#endif
+
+	}
+
+	// wait_baseline() blocks until the helper thread has found the baseline
+	void wait_baseline(Baseline *b) {
+		if (!b || !b->running)
+			return;
+
+#if defined(_MSC_VER)
+		WaitForSingleObject(b->handle, INFINITE);
+		CloseHandle(b->handle);
+#else
+		pthread_join(b->handle, NULL);
+#endif
+		b->running = false;
+	}
+
+	// delete_baseline() joins the helper thread of a baseline and frees it
+	void delete_baseline(Baseline *b) {
+		wait_baseline(b);
+		lock_destroy(&b->lock);
+		delete b->root;
+		delete b;
+	}
+
+	// drop_baseline() discards the current baseline. A helper thread still
+	// running is not waited for, its baseline is deleted by a later call
+	// once it is ready.
+	void drop_baseline() {
+		if (baseline && baseline->running && !baseline->ready)
+			staleBaselines.push_back(baseline);
+		else if (baseline)
+			delete_baseline(baseline);
+		baseline = NULL;
+
+		for (size_t i = 0; i < staleBaselines.size(); )
+			if (staleBaselines[i]->ready) {
+				delete_baseline(staleBaselines[i]);
+				staleBaselines.erase(staleBaselines.begin() + i);
+			}
+			else
+				i++;
+	}
+
+	// start_baseline() finds the baseline of a root on a helper thread, or
+	// at once if no thread can be started.
+	void start_baseline(const Position& root, const RootRecord *reference) {
+		drop_baseline();
+
+		Baseline *b = baseline = new Baseline();
+		lock_init(&b->lock);
+		b->root = new Position(root, root.thread());
+		b->method = simMethod;
+		b->depth = similarityDepth();
+		b->hasReference = (reference != NULL);
+		if (reference)
+			b->reference = *reference;
+		b->ready = false;
+
+#if defined(_MSC_VER)
+		b->handle = CreateThread(NULL, 0, baseline_routine, (LPVOID)b, 0, NULL);
+		b->running = (b->handle != NULL);
+#else
+		b->running = !pthread_create(&b->handle, NULL, baseline_routine, (void*)b);
+#endif
+		if (!b->running)
+			find_baseline(b);
+	}
+
+	// baseline_of() tells whether the current baseline, ready or not, belongs
+	// to the given root and reference positions.
+	bool baseline_of(const Position& root, const RootRecord *reference) {
+		return    baseline
+		       && baseline->method == simMethod
+		       && baseline->depth == similarityDepth()
+		       && baseline->root->get_key() == root.get_key()
+		       && (baseline->hasReference ? reference && baseline->reference.key == reference->key
+		                                  : !reference);
+	}
+
+	// pick_sim_method() returns the method set by the "Similarity Method"
+	// option. "Auto" picks the most faithful of the recursive, the flat and
+	// the constant move based measures whose typical time (bounded by the
+	// sampling budget) fits in a small share of the thinking time.
+	SimMethod pick_sim_method() {
+		string name = Options["Similarity Method"].value<string>();
+		for (int i = 0; i < SIM_METHOD_NB; i++)
+			if (name == SimMethods[i].name)
+				return SimMethod(i);
+
+		const SimMethod candidates[] = { REC_LEGAL_MOVES, LEGAL_MOVES, CONSTANT };
+		for (int i = 0; i < 2; i++) {
+			int cost = simCostTime(SimMethods[candidates[i]].cost);
+			if (simBudget && SimMethods[candidates[i]].cost == COST_QUADRATIC)
+				cost = Min(cost, simBudget);
+
+			// Without a clock the search is not in a hurry
+			if (!Limits.time || cost <= thinkingTime * 1000 / simTimeShare)
+				return candidates[i];
+		}
+		return CONSTANT;
+	}
+
+	// baseline_ready() tells whether the helper thread has found the baseline.
+	// Taking the lock makes its results visible to the calling thread.
+	bool baseline_ready() {
+		if (!baseline->ready)
+			return false;
+
+		lock_grab(&baseline->lock);
+		lock_release(&baseline->lock);
+		return true;
+	}
+
+	// use_baseline() installs the trap moves of the baseline and returns the
+	// similarity to be used by the playouts.
+	// A trap state seen earlier in the game or loaded from the corpus may be
+	// closer to the root than the previous root, then its traps are used too.
+	double use_baseline(Position& pos) {
+		double sim = baseline->estimate.sim;
+
+		lastTrapMove = std::copy(baseline->traps, baseline->lastTrap, trapMoves);
+
+		if (Options["Trap Index"].value<bool>()) {
+			MoveStack *lastRootTrap = lastTrapMove;
+			double indexSim = 0;
+			const TrapState *nearest = TrapStates.nearest(&pos, indexSim);
+			if (nearest && indexSim > sim) {
+				sim = indexSim;
+				for (int i = 0; i < nearest->trapCount && lastTrapMove != trapMoves + MAX_MOVES; i++)
+					if (!trapcheck(nearest->traps[i]))
+						(lastTrapMove++)->move = nearest->traps[i];
+			}
+			TrapStates.insert(&pos, trapMoves, lastRootTrap);
+		}
+		return sim;
+	}
+}
+
 bool uct(Position& pos, const SearchLimits& limits){
 	 // Read UCI options
 	UCIMultiPV = Options["MultiPV"].value<int>();
+	randomSeed = Options["Random Seed"].value<int>();
+	playoutsPerLeaf = Options["Playouts Per Leaf"].value<int>();
+	simBudget = Options["Similarity Budget"].value<int>();
+	setSimilarityDepth(Options["Similarity Depth"].value<int>());
+
+	// Leaf parallelism uses the material tables of the helper threads
+	Threads.read_uci_options();
+	Threads.init_hash_tables();
 
 	// Initialize variables for the new search
 	Limits = limits;
@@ -99,6 +354,17 @@ bool uct(Position& pos, const SearchLimits& limits){
 	iterations = 0;
 	thinkingTime = Limits.time / timeRate;
 	searchStartTime = get_system_time();
+	simMethod = pick_sim_method();
+
+	// A zero seed makes the playouts non deterministic
+	if (!randomSeed)
+		randomSeed = searchStartTime;
+	seed_playouts(randomSeed);
+	for (int i = 0; i < MAX_THREADS; i++)
+		if (Threads[i].materialTable.endgames())
+			Threads[i].materialTable.endgames()->clear_stats();
+	init_playout_cache(Options["Playout Cache"].value<bool>());
+	set_implicit_minimax(Options["Implicit Minimax Weight"].value<int>() / 100.0);
 
 	MonteCarloTreeNode * root = new MonteCarloTreeNode(MOVE_NONE, NULL, VALUE_ZERO);
 	MonteCarloTreeNode * selected0;
@@ -107,16 +373,38 @@ bool uct(Position& pos, const SearchLimits& limits){
 	MonteCarloTreeNode * expanded1;
 	double result, sim;
 
-	if (whiteToMove) {
-		sim = similarity<LEGAL_MOVES>(&pos, prevPosBlanc);
-		prevPosBlanc = new Position(pos,pos.thread());
-	}
-	else {
-		sim = similarity<LEGAL_MOVES>(&pos, prevPosNoir);
-		prevPosNoir = new Position(pos,pos.thread());
+	// The similarity and the trap moves of the root may have been found
+	// during the opponent's time, otherwise a helper thread finds them while
+	// the search runs with the default similarity and no trap moves.
+	RootHistory& history = rootHistory[pos.side_to_move()];
+	if (!baseline_of(pos, history.last()))
+		start_baseline(pos, history.last());
+	history.push(pos);
+
+	if (Options["Trap Index"].value<bool>()) {
+		string corpus = Options["Trap Corpus"].value<string>();
+		if (corpus != TrapStates.name()) {
+			if (corpus.empty())
+				TrapStates.clear();
+			else
+				TrapStates.load(corpus);
+		}
 	}
 
+	sim = DEFAULT_SIM;
+	lastTrapMove = trapMoves;
+	bool baselineUsed = false;
+
+	// A fixed seed asks for a reproducible search, so the baseline is not
+	// allowed to arrive at a random iteration.
+	if (Options["Random Seed"].value<int>())
+		wait_baseline(baseline);
+
 	while(!StopRequest) {
+		if (!baselineUsed && baseline_ready()) {
+			sim = use_baseline(pos);
+			baselineUsed = true;
+		}
 		selected0 = root->UCT_select(&pos);
 		expanded0 = selected0->UCT_expand(&pos);
 		selected1 = expanded0->UCT_select(&pos);
@@ -124,33 +412,75 @@ bool uct(Position& pos, const SearchLimits& limits){
 		//selected2 = expanded1->UCT_select(&pos);
 		//expanded2 = selected2->UCT_expand(&pos);
 		result = expanded1->simulate(sim, &pos);
-		expanded1->update(result, &pos);
+
+		// The remaining playouts of the leaf are run in a batch and backed up
+		// with the first one. A mate score proves the leaf and is backed up
+		// alone, the batch would only repeat it.
+		if (playoutsPerLeaf > 1 && !is_proven(result)) {
+			double batch = expanded1->simulate(sim, &pos, playoutsPerLeaf - 1, Threads.size());
+			if (is_proven(batch))
+				expanded1->update(batch, &pos);
+			else
+				expanded1->update(result + batch, &pos, playoutsPerLeaf);
+		}
+		else
+			expanded1->update(result, &pos);
 		if (iterations++ % 1000 == 0)
 			uct_poll(root);
+		if (Limits.maxNodes && iterations >= (unsigned int) Limits.maxNodes)
+			StopRequest = true;
 	}
 
 	root->printMultiPv(depth, iterations, current_search_time(), whiteToMove, UCIMultiPV);
-	cout << "info string " << "sim=" << sim << endl;
-	cout << "bestmove " << move_to_uci(root->bestChild()->lastMove, false) << endl;
+	cout << "info string " << "sim=" << sim;
+	if (!baselineUsed)
+		cout << " (baseline pending)";
+	else if (baseline->estimate.samples < baseline->estimate.total)
+		cout << " [" << baseline->estimate.low << ", " << baseline->estimate.high << "] from "
+		     << baseline->estimate.samples << "/" << baseline->estimate.total << " mismatches";
+	cout << " method=" << SimMethods[simMethod].name << " seed=" << randomSeed << endl;
+
+	uint64_t endgameHits = 0, endgameMisses = 0;
+	for (int i = 0; i < MAX_THREADS; i++)
+		if (Threads[i].materialTable.endgames()) {
+			endgameHits += Threads[i].materialTable.endgames()->hits();
+			endgameMisses += Threads[i].materialTable.endgames()->misses();
+		}
+	cout << "info string endgame hits=" << endgameHits << " misses=" << endgameMisses << endl;
+
+	// A root without legal moves has no child to play
+	MonteCarloTreeNode *best = root->bestChild();
+	cout << "bestmove " << move_to_uci(best ? best->lastMove : MOVE_NONE, false) << endl;
+
+	// Find the baseline of our next root during the opponent's time, assuming
+	// the opponent plays the reply expected by the search.
+	MonteCarloTreeNode *reply = best ? best->bestChild() : NULL;
+	if (!QuitRequest && reply) {
+		Position next(pos, pos.thread());
+		next.do_setup_move(best->lastMove);
+		next.do_setup_move(reply->lastMove);
+		start_baseline(next, history.last());
+	}
+
+	// This makes the threads used by the playouts go to sleep
+	Threads.set_size(1);
 
 	delete root;
 	return !QuitRequest;
 }
 
+// uct_exit() joins the helper threads still finding a baseline. It is
+// called once on program exit.
+void uct_exit() {
+	drop_baseline();
+	for (size_t i = 0; i < staleBaselines.size(); i++)
+		delete_baseline(staleBaselines[i]);
+	staleBaselines.clear();
+}
+
 bool trapcheck(Move m) {
-	MoveStack mlist[MAX_MOVES];
-	MoveStack *last;
-	if (whiteToMove) {
-		last = generate<TRAP>(prevPosBlanc, mlist);
-		for (MoveStack *i = mlist; i != last; i++) {
-			if (m == i->move) return true;
-		}
-	}
-	else {
-		last = generate<TRAP>(prevPosNoir, mlist);
-		for (MoveStack *i = mlist; i != last; i++) {
-			if (m == i->move) return true;
-		}
+	for (MoveStack *i = trapMoves; i != lastTrapMove; i++) {
+		if (m == i->move) return true;
 	}
 	return false;
-}
+}
\ No newline at end of file
@@ -7,5 +7,6 @@
 
 extern bool uct(Position& pos, const SearchLimits& limits);
 extern bool trapcheck(Move m);
+extern void uct_exit();
 
 #endif /* UCTSEARCH_H_ */